@@ -8,7 +8,7 @@
 #include <libopencm3/stm32/gpio.h>
 #include <gfx.h>
 #include <qrencode.h>
-#include "time.h"
+#include "../util/time.h"
 #include "../util/util.h"
 
 
@@ -0,0 +1,1135 @@
+/*
+ * spinner.c -- the spinner pattern, written by tools/hub75_anim.py
+ *
+ * 12 frames at 12 frames a second, 4 bits deep, for 64x64 with
+ * 32 scan rows of 64 clocks. Do not edit, bake it again.
+ */
+
+#include <stdint.h>
+#include "../util/hub75.h"
+
+static const uint8_t spinner_data[13428] = {
+	0x09, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0xb8, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0xb9, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00,
+	0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xbb, 0x00, 0x04, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0xbe, 0x02, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x7a, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x79, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39,
+	0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00,
+	0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x79, 0x00, 0x07,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7a, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7c, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x04, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x35, 0x00, 0x02, 0x00, 0x18, 0x18, 0x04, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x35, 0x00, 0x02, 0x00, 0x18, 0x18, 0x44, 0x00, 0x05,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x79, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x04, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x31, 0x00,
+	0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x00, 0x04,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x31, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x04, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00, 0x11, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00, 0x12,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x00, 0x12, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x00, 0x12, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x2a, 0x00, 0x16, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x29,
+	0x00, 0x17, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x30, 0x00, 0x10, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00,
+	0x10, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x28, 0x00, 0x0b, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x05, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x31, 0x00, 0x02, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x27, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0a, 0x00, 0x06,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x28, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x0b, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x2a, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xf9, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xfa, 0x00, 0x05, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0xf9, 0x02, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x3c, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0xbb, 0x00, 0x06, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3a, 0x00, 0x06, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0xb9, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0xb8, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3e, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x3b, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x22,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x0e, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x28,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x26, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x0c, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x26, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31,
+	0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x04, 0x00, 0x07, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x00, 0x04, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x04, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x26, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x26, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x04, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x30, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00,
+	0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x24, 0x00, 0x1c, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x24, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e,
+	0x00, 0x12, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x00, 0x12,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x24, 0x00, 0x1c, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x24, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x20,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x26,
+	0x00, 0x1a, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x20,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x30, 0x00, 0x10, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x28, 0x00, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x28, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x20, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x00, 0x02, 0x00, 0x38,
+	0x38, 0x31, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x05, 0x00, 0x02, 0x00, 0x38, 0x38, 0x2a, 0x00, 0x02, 0x00, 0x18,
+	0x18, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x02, 0x00, 0x38, 0x38, 0x2a, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x05, 0x00, 0x02, 0x00, 0x38, 0x38, 0x20, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3a, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x04, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x3c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+	0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x2a, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x39, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x03, 0x05, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x05,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x05, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x3a, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1a, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39,
+	0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00,
+	0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x07, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x3a, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1a, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x05, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x3b, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x3b, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x00, 0x05,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x00, 0x02, 0x00, 0x38, 0x38,
+	0x1c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x04, 0x00, 0x02, 0x00, 0x38, 0x38, 0x22, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x38, 0x38, 0x35, 0x00, 0x05,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x00, 0x02, 0x00, 0x38, 0x38,
+	0x34, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39,
+	0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x26, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x26, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x08, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x24, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38,
+	0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38,
+	0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x24,
+	0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x12, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x28, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x3d, 0x00, 0x02, 0x00, 0x18, 0x18, 0x3e, 0x00, 0x02, 0x00, 0x18, 0x18,
+	0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0xb2, 0x00, 0x06, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xbb, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x05, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfb, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00,
+	0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x04, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x18, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1c, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00,
+	0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x19, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1a, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39,
+	0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x07, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x17, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x17, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1a, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+	0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x05, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00,
+	0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x02, 0x00, 0x18, 0x18, 0x22, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x02, 0x00, 0x18, 0x18, 0x35, 0x00,
+	0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x35, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x18, 0x18, 0x61, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4c, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x66, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x64, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x42, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x65, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x3e, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfb, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x05,
+	0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x3c, 0x00, 0x04, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x3c, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x3c, 0x00,
+	0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x06, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x3a, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x3a, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x3a, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x39, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x3a, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x06, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x04, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x04, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0xb9, 0x02, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xba, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x18, 0x18, 0x3e, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x21, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x02, 0x00, 0x07, 0x07, 0x2a, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x02,
+	0x00, 0x07, 0x07, 0x34, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x3e, 0x00, 0x02, 0x00, 0x07,
+	0x07, 0x22, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x29, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x34, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x05, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00, 0x16,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x28, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x35, 0x00, 0x0b,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39,
+	0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x28,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x29, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3a, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3e, 0x02, 0x04,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x3c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x04,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x3a, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a,
+	0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xaf, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xb8, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xb9, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x04,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xb9, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x02, 0x00,
+	0x07, 0x07, 0x3e, 0x00, 0x02, 0x00, 0x07, 0x07, 0x3e, 0x00, 0x0b, 0x00,
+	0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+	0x00, 0x02, 0x00, 0x07, 0x07, 0x3c, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3b,
+	0x00, 0x0c, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x34, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x3a, 0x00, 0x07, 0x00, 0x07, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x07, 0x39,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00,
+	0x0c, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x34, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x39, 0x00, 0x08, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x30, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08,
+	0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x07, 0x38, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x2f, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x39, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x00, 0x38, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x2f, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x39, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x38, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x2f, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x04, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x34, 0x00, 0x0c, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x35, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x02, 0x00, 0x03, 0x03, 0x2a, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x34, 0x00, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3b,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x05, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x29, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x35, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x29, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x29, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x3a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x3b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0xbe, 0x02, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3c,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xb9, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xb8, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xb9, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x04, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x3c, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x29, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x3c, 0x00, 0x04, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x3a, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x0a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3a, 0x00,
+	0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x00, 0x02, 0x00,
+	0x03, 0x03, 0x31, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x05, 0x00, 0x0b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31,
+	0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05,
+	0x00, 0x02, 0x00, 0x03, 0x03, 0x31, 0x00, 0x10, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x30, 0x00, 0x17, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x10, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x10, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x30, 0x00, 0x11, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x2f, 0x00, 0x16, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x11, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x2f, 0x00, 0x12, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2e,
+	0x00, 0x12, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2e, 0x00, 0x12,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x12, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x2f, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x2f, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2f,
+	0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x11, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x30, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x04, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x30, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x31, 0x00, 0x04, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x38, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x3a, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x02, 0x00, 0x03, 0x03, 0x35, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x02, 0x00, 0x00, 0x00, 0x82, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xb9, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x02, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfb, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfb, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x02,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x29, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x3b, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0a,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+	0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3a, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x32, 0x00, 0x02, 0x00, 0x07, 0x07, 0x05,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x09,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+	0x02, 0x00, 0x07, 0x07, 0x05, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x31, 0x00, 0x02, 0x00, 0x07, 0x07, 0x05, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x03, 0x03, 0x2a, 0x00, 0x02, 0x00, 0x07, 0x07, 0x05, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x29, 0x00, 0x10, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x0a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x10,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x30, 0x00, 0x18, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x28, 0x00, 0x18,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x27, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0c, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x2f, 0x00, 0x1a, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x00, 0x1a, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x25, 0x00, 0x12, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2e,
+	0x00, 0x12, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2e, 0x00, 0x1c,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x24, 0x00, 0x1c, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x24, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2f, 0x00,
+	0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2f, 0x00, 0x1c, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x24, 0x00, 0x1c, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00,
+	0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x31, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x31, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x04, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x26, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0e, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x22, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0e, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf9, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf8, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfa, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x02,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x69, 0x06, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x06, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x32, 0x00, 0x02, 0x00, 0x03, 0x03, 0x3e, 0x00, 0x02, 0x00,
+	0x03, 0x03, 0x3e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x03, 0x03, 0x05, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x05, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x3b, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x10, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x2f, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x39, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x11, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+	0x00, 0x12, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x1c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x11, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x31, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x39, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x34, 0x00, 0x02, 0x00,
+	0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x35,
+	0x00, 0x02, 0x00, 0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00,
+	0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x02, 0x00,
+	0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x34,
+	0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x05, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x1c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3b,
+	0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3a, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x3a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1c,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x05, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x3b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x5f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x39, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00,
+	0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00, 0x06, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0xcf, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x2a, 0x00, 0x02, 0x00, 0x03, 0x03, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x90, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x10,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x8d, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x26, 0x00, 0x11, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x12,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x11, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x26, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x17, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x35, 0x00, 0x02, 0x00, 0x03, 0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x34, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x1c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x3a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3a, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1c, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x3b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x02, 0x04, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x3c, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x3c, 0x00,
+	0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x3c, 0x00, 0x04, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x3b, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x3a, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3a, 0x00,
+	0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3a, 0x00, 0x06, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x39, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x00, 0x08, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00,
+	0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+	0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00,
+	0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00,
+	0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+	0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00,
+	0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x06, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3b, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00,
+	0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3e, 0x02,
+	0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x05, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x3b, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3a, 0x00,
+	0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0a, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x08, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x16, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x21, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x0b, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x35, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x3a, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x15,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x05, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x0c, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x05,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x02, 0x00, 0x38, 0x38,
+	0x16, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x00, 0x02, 0x00, 0x38, 0x38, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x0c, 0x00, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x02,
+	0x00, 0x38, 0x38, 0x56, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x62, 0x00, 0x02, 0x00, 0x03, 0x03, 0x04, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbd,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xb8, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xb8, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xb9, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xb9, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3b, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x02, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x3c, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x00, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x3b, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3a,
+	0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3a, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x06,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x3c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x02, 0x05,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x07,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x38, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0a, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x08, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0b, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3a, 0x00, 0x05, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x0c, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x3c, 0x00, 0x02, 0x00, 0x18, 0x18, 0x04, 0x00, 0x10, 0x00,
+	0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x0c, 0x00, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x34, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x35,
+	0x00, 0x02, 0x00, 0x18, 0x18, 0x04, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x3a, 0x00, 0x11, 0x00, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+	0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
+	0x00, 0x08, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39,
+	0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00,
+	0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x10,
+	0x00, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x08, 0x00, 0x38, 0x3b, 0x3b, 0x3b, 0x3b,
+	0x3b, 0x3b, 0x3b, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x08, 0x00, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38,
+	0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39,
+	0x00, 0x07, 0x00, 0x38, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x38, 0x39, 0x00,
+	0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x00, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x39, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x3a, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x00, 0x05,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x00,
+	0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x00, 0x02, 0x00, 0x38,
+	0x38, 0x3e, 0x00, 0x02, 0x00, 0x38, 0x38, 0x35, 0x00, 0x0b, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x3e, 0x00,
+	0x02, 0x00, 0x38, 0x38, 0xb4, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xfa, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
+	0x02, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x3c, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xbb, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x3a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x38,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x89, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xf9, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xfb, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x05,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xba, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xb9, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8,
+	0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8,
+	0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x75, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x74, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3b, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x07, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x3a, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x35, 0x00, 0x02, 0x00, 0x18, 0x18, 0x04, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04,
+	0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x08, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x39, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x08, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x31, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x04, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x31, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x31, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x04, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00,
+	0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00,
+	0x12, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x00, 0x12, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x2e, 0x00, 0x12, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x2f, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2a,
+	0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x2f, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00,
+	0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00, 0x10, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x29, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x30, 0x00, 0x10, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x00,
+	0x02, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x28, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x31, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x31, 0x00, 0x02, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x39, 0x00, 0x06, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x28, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x3a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b,
+	0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x29, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x3c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x3c,
+	0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x6a, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x39, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const struct hub75_anim spinner = {
+	32, 64, 4, HUB75_ANIM_DELTA, 12, 12, sizeof(spinner_data), spinner_data
+};
@@ -0,0 +1,1152 @@
+/*
+ * spinner.c -- the spinner pattern, written by tools/hub75_anim.py
+ *
+ * 12 frames at 12 frames a second, 4 bits deep, for 64x64 with
+ * 16 scan rows of 128 clocks. Do not edit, bake it again.
+ */
+
+#include <stdint.h>
+#include "../util/hub75.h"
+
+static const uint8_t spinner_data[13631] = {
+	0x1d, 0x00, 0x1a, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x4c, 0x00, 0x1a, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x4c, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7a, 0x00,
+	0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6e, 0x00, 0x1b, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x4b, 0x00, 0x1b, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x4b, 0x00, 0x08,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x00, 0x12,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6e, 0x00, 0x1a, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x14, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x4c,
+	0x00, 0x1a, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x14, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x4c, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x78, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x6f, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x00, 0x04, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x4d, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x00, 0x04, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x4d, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x78, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x08, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00,
+	0x18, 0x18, 0x71, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x71, 0x00, 0x08, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x00, 0x08, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00,
+	0x18, 0x18, 0x72, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x7a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7a, 0x00,
+	0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7a, 0x00, 0x06, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7b, 0x00, 0x04, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x0c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x4c, 0x00, 0x04, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x0c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x6b, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x0c, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x6b, 0x00, 0x04, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x8b, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x5a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xf9, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x18, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xf9, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xf8, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xf8, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xfa, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5c, 0x00, 0x05, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0xf4, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04,
+	0x00, 0x02, 0x00, 0x03, 0x03, 0x1c, 0x00, 0x02, 0x00, 0x03, 0x03, 0x57,
+	0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x02, 0x00,
+	0x03, 0x03, 0x7e, 0x00, 0x02, 0x00, 0x03, 0x03, 0x75, 0x00, 0x05, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x7a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0xf9, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x71, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x04,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x7c, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12,
+	0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6f, 0x00, 0x11, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x1c, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x64, 0x00, 0x1c, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x12,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6e, 0x00, 0x12, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x1c, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x64, 0x00, 0x1c, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x11,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6f, 0x00, 0x11, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x0c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+	0x00, 0x1a, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x66, 0x00, 0x1a, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67,
+	0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x10, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x0d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x18, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x68,
+	0x00, 0x18, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x69, 0x00, 0x02, 0x00, 0x38, 0x38, 0x05, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x71, 0x00, 0x02,
+	0x00, 0x38, 0x38, 0x05, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x71, 0x00, 0x02, 0x00, 0x38, 0x38, 0x05, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x6a, 0x00, 0x02, 0x00, 0x38, 0x38, 0x05, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x72, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x7a, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7a,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x06,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7b, 0x00, 0x04, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x2b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x7c, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x6b, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0xaa, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x19, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xdc, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x35, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0e, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x67, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x66,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x04, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x04, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x71,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x66, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x15, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x78, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+	0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x08, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00, 0x1c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x12, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x6f, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x16, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x07,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x79, 0x00, 0x1a, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x66, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7b, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x68, 0x00, 0x10, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x7e, 0x00, 0x02, 0x00, 0x18, 0x18, 0x7e, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x79, 0x01, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x7a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a,
+	0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x1c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x5a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c,
+	0x00, 0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x6b, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x56, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x56, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7a, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x1c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x5a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7c, 0x00, 0x02, 0x00, 0x07, 0x07,
+	0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x75, 0x00, 0x02,
+	0x00, 0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x17, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x02, 0x00, 0x07, 0x07,
+	0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x02, 0x00, 0x07, 0x07,
+	0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7a, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x5e, 0x00, 0x08, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x08, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x15, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x1a, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4c, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x12, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x5e, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x15, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00,
+	0x1b, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x11, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x55, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x13, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x60, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x14, 0x00,
+	0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x06, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x14, 0x00, 0x1a, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c,
+	0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x14, 0x00, 0x10,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x15, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x62,
+	0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x04, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x18, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x04, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x05, 0x00, 0x10, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4d, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x04, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x58, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0xb4, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x6a, 0x00, 0x02, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x86, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xea, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1c, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x05, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7a, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x08, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x7a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x1c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x7c, 0x00, 0x02, 0x00, 0x03, 0x03, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x02, 0x00, 0x03, 0x03, 0x17, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x62, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x75, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x71, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x15, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x0c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4c, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x12, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5e, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x15, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0b, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5e, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x13, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x14, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x14, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x60, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x15, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x18, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x16, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x0d, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x04,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x04, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x62, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x34, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x71, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0x01,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x01, 0x05, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x2b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4c, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5c, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5c, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7a, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x5a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00,
+	0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x7a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5c, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5c, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x34, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x02, 0x00, 0x07,
+	0x07, 0x7e, 0x00, 0x02, 0x00, 0x07, 0x07, 0x1c, 0x00, 0x02, 0x00, 0x03,
+	0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00,
+	0x02, 0x00, 0x07, 0x07, 0x1c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x00,
+	0x02, 0x00, 0x07, 0x07, 0x34, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xe6, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0c, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x71, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x24, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1b, 0x00,
+	0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x55, 0x00,
+	0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x11, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x24, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x1b, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x55, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x55, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
+	0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x26, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x07, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1d, 0x00, 0x06, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x56, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x14, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+	0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x05, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x28, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4e, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1f, 0x00,
+	0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x58, 0x00, 0x05, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x05, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x16,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x05, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x02, 0x00, 0x38, 0x38, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x52, 0x00, 0x02, 0x00, 0x38, 0x38, 0x7e, 0x00, 0x02, 0x00, 0x38, 0x38,
+	0x7e, 0x00, 0x02, 0x00, 0x38, 0x38, 0x32, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x5c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7a, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x18, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+	0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x18, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7a, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x7b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x74, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x04, 0x00, 0x02, 0x00, 0x03, 0x03, 0x22, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4e, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x04, 0x00, 0x02, 0x00, 0x03, 0x03, 0x1c, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x75, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x04, 0x00, 0x02, 0x00, 0x03, 0x03, 0x74, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x26, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x26, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x11, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x6f, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x1b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4c, 0x00, 0x1a, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x11, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x24, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x12, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x6e, 0x00, 0x12, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x1b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4b, 0x00, 0x1b, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x12, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x25, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x6f, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x1a,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x66, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x27, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x10,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x10,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x67, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x29, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x45, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x71, 0x00, 0x08,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x05, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x71, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x71, 0x00, 0x08,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x05, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x72, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x7a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7a,
+	0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7a, 0x00, 0x06,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7b, 0x00, 0x04, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x2b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x7c, 0x00, 0x04, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x0c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x6b, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x0c, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xda, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xda, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x96, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xda, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x7b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x75, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4c, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x04,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x04, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x71,
+	0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x04, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x04, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x26, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x41, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0c,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b,
+	0x00, 0x1c, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x64, 0x00, 0x1c, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x64, 0x00, 0x12, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x25, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x00, 0x12, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0b,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b,
+	0x00, 0x1c, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x64, 0x00, 0x1c, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x65, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x26, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00,
+	0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0c, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x1a, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x66,
+	0x00, 0x1a, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x27, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x10,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x0d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5f, 0x00, 0x18, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x68, 0x00, 0x18, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x02,
+	0x00, 0x38, 0x38, 0x05, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x71, 0x00, 0x02, 0x00, 0x38, 0x38, 0x05, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x71, 0x00, 0x02,
+	0x00, 0x38, 0x38, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x6a, 0x00, 0x02,
+	0x00, 0x38, 0x38, 0x05, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x72, 0x00, 0x06,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7a, 0x00, 0x06, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x7a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7a, 0x00, 0x06, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x2a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00,
+	0x04, 0x00, 0x18, 0x18, 0x18, 0x18, 0x7c, 0x00, 0x04, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x7c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x04, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x2a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x5a, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x98, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x5a, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x01,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x9b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x44, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x0e, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x62, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x0e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x66, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x66, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x04, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x71, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x04,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x66,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00,
+	0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x00, 0x1c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x11, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x26, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x15, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x5b, 0x00, 0x08, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x78, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
+	0x12, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x07, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x5d, 0x00, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x79, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x11, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x45, 0x00, 0x05, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x05, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x7b, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x10, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x02, 0x00, 0x18, 0x18, 0x7e, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x7e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x05, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x6a, 0x00, 0x02, 0x00, 0x18, 0x18, 0x05, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x01, 0x06,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7a, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1c,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x05, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x00, 0x04, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x6b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0c, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x7a, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x7b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1c, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x05, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x7c, 0x00, 0x02, 0x00, 0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x75, 0x00, 0x02, 0x00, 0x07, 0x07, 0x04, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x17, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x02, 0x00, 0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x62, 0x00, 0x02, 0x00, 0x07, 0x07, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x7a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x66, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2f, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x12, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x5e, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x12, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x15, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x12, 0x00, 0x1a, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x08, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x11, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x5e, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x15, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x12, 0x00, 0x1b, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b,
+	0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12,
+	0x00, 0x11, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x06, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x14, 0x00, 0x06, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x60, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x14, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x16, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+	0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x14, 0x00, 0x1a,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4c, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x14, 0x00, 0x10, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x04,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x62, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x04,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x45, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00,
+	0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x05, 0x00, 0x10, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4d, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x16, 0x00,
+	0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x01, 0x02, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x02,
+	0x00, 0x18, 0x18, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x02, 0x00, 0x00, 0x00, 0x86, 0x01, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x00, 0x05, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x1c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x6b, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x7a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x56, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x1a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x56, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x1a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7a, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1c, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x5a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x7b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7c, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x17, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x75, 0x00, 0x02, 0x00, 0x03, 0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0d, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x66, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x15, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0c, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x5e, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x15, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x0b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x55, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x5f, 0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x14,
+	0x00, 0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x06, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x14, 0x00, 0x06, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00,
+	0x06, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x14, 0x00, 0x06, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x61, 0x00, 0x04, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x16, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x18, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x04, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x16, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x0d,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x58, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x04, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x9a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x71, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x86, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4b, 0x01, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b,
+	0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x2b, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x1a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5c, 0x00,
+	0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x5a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00,
+	0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x07, 0x00, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x78, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x5a, 0x00, 0x08, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x18, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x5a, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x18,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00,
+	0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x7b, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x1a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5c, 0x00,
+	0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1a, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x02, 0x00, 0x07, 0x07, 0x35, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x02, 0x00, 0x07,
+	0x07, 0x7e, 0x00, 0x02, 0x00, 0x07, 0x07, 0x1c, 0x00, 0x02, 0x00, 0x03,
+	0x03, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00,
+	0x02, 0x00, 0x07, 0x07, 0x1c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x96, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x08, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2f, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x24, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x12, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x55, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2e, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,
+	0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x24, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00,
+	0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0x00, 0x08, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x55, 0x00, 0x11, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x42, 0x00, 0x07, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x26, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4c, 0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x14, 0x00, 0x06,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x56, 0x00, 0x10, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x57, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x30, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00,
+	0x05, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x28, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x05, 0x00, 0x04, 0x00, 0x03, 0x03, 0x03, 0x03, 0x16, 0x00, 0x04,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x58, 0x00, 0x05, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x02, 0x00, 0x38, 0x38,
+	0x31, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x02, 0x00, 0x38, 0x38, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x52, 0x00, 0x02, 0x00, 0x38, 0x38, 0x7e, 0x00, 0x02, 0x00, 0x38, 0x38,
+	0xb2, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x01,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2b, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x7b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x7a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00,
+	0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x08, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x7a, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x74, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x75, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x02,
+	0x00, 0x03, 0x03, 0x22, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4e, 0x00, 0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x02, 0x00, 0x03, 0x03,
+	0x74, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x26, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x07,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79, 0x00, 0x07, 0x00, 0x07,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x44, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x07, 0x26, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x79,
+	0x00, 0x07, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x1d, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x24,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+	0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6f, 0x00, 0x1a, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4c, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6e,
+	0x00, 0x12, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x24, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x12,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6e, 0x00, 0x1b, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4b, 0x00, 0x12, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x6e, 0x00, 0x11, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x26, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x11, 0x00,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x6f, 0x00, 0x1a, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x11,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x6f, 0x00, 0x10, 0x00, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x28, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+	0x00, 0x10, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0x00, 0x10, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x10, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x70, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x2a, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x45, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x71, 0x00, 0x08,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x05, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x08, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x05, 0x00, 0x02, 0x00, 0x18, 0x18, 0x72, 0x00, 0x06,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7a, 0x00, 0x06, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x38, 0x38, 0x7a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38,
+	0x38, 0x38, 0x38, 0x7a, 0x00, 0x06, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
+	0x38, 0x7b, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x7c, 0x00, 0x04,
+	0x00, 0x38, 0x38, 0x38, 0x38, 0x2b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x4c, 0x00, 0x04, 0x00, 0x38, 0x38, 0x38, 0x38, 0x0c, 0x00,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x6b, 0x00, 0x04, 0x00, 0x38,
+	0x38, 0x38, 0x38, 0x0c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x19, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+	0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x08, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x19, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7b, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x28, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x4e, 0x00, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x22, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x02, 0x00, 0x03, 0x03, 0x75, 0x00, 0x05, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, 0x00, 0x07,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x00, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x07, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x79, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07,
+	0x04, 0x00, 0x07, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26,
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+	0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x71, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07,
+	0x07, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x71, 0x00, 0x04, 0x00, 0x07, 0x07, 0x07, 0x07, 0x04, 0x00, 0x07, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+};
+
+const struct hub75_anim spinner = {
+	16, 128, 4, HUB75_ANIM_DELTA, 12, 12, sizeof(spinner_data), spinner_data
+};
@@ -0,0 +1,258 @@
+/*
+ * arena.c -- arena allocator and heap statistics
+ *
+ * The QR clock calls libqrencode for every frame, which mallocs and
+ * frees dozens of small blocks each time. From the heap that takes a
+ * different amount of time on every call and leaves holes behind.
+ * Instead malloc(), calloc(), realloc() and free() are wrapped (the
+ * demo links with -Wl,--wrap=malloc and so on) and while an arena is
+ * in use allocations are just carved off the end of it. free() of an
+ * arena block does nothing, arena_reset() gives back the whole lot at
+ * once. A request that doesn't fit comes from the heap as usual (and
+ * is counted), so running out is slow but not fatal.
+ *
+ * Everything that does go to the heap is counted too, so we can see
+ * how much is live, the most there has been, and how much of the heap
+ * is sitting free in holes.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <malloc.h>
+#include "../util/util.h"
+
+#define ARENA_ALIGN		8
+#define ARENA_HDR		8		/* block size, padded to ARENA_ALIGN */
+#define ARENA_ROUND(n)	(((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t n, size_t size);
+void *__wrap_realloc(void *p, size_t size);
+void __wrap_free(void *p);
+
+static struct arena *current;		/* where malloc() goes, NULL is the heap */
+static struct arena *arenas;		/* all of them, to recognize their blocks */
+
+static uint32_t heap_live;
+static uint32_t heap_peak;
+static uint32_t heap_blocks;
+
+/*
+ * Set up an arena in 'buf'. Arenas are never torn down, free() needs
+ * to know about all of them for as long as their blocks might be
+ * around.
+ */
+void
+arena_init(struct arena *a, void *buf, uint32_t size)
+{
+	uint32_t	pad;
+
+	pad = ARENA_ROUND((uint32_t) buf) - (uint32_t) buf;
+	a->base = (uint8_t *) buf + pad;
+	a->size = (size - pad) & ~(ARENA_ALIGN - 1);
+	a->used = 0;
+	a->last = 0;
+	arena_reset_stats(a);
+	a->next = arenas;
+	arenas = a;
+}
+
+/* Forget everything allocated from 'a', in constant time */
+void
+arena_reset(struct arena *a)
+{
+	a->used = 0;
+	a->last = 0;
+}
+
+void
+arena_reset_stats(struct arena *a)
+{
+	a->peak = a->used;
+	a->allocs = 0;
+	a->overflows = 0;
+}
+
+/*
+ * Point malloc() at 'a' (or back at the heap with NULL), returns the
+ * arena that was in use so calls can nest.
+ */
+struct arena *
+arena_use(struct arena *a)
+{
+	struct arena	*prev;
+
+	prev = current;
+	current = a;
+	return prev;
+}
+
+/*
+ * Take 'size' bytes from the arena, NULL if they don't fit. Each
+ * block is preceded by its size so that realloc() can copy it.
+ */
+void *
+arena_alloc(struct arena *a, uint32_t size)
+{
+	uint32_t	need;
+	uint8_t		*p;
+
+	need = ARENA_HDR + ARENA_ROUND(size);
+	if ((size > a->size) || (need > a->size - a->used)) {
+		a->overflows++;
+		return NULL;
+	}
+	p = a->base + a->used;
+	*(uint32_t *) p = size;
+	a->last = a->used;
+	a->used += need;
+	if (a->used > a->peak) {
+		a->peak = a->used;
+	}
+	a->allocs++;
+	return p + ARENA_HDR;
+}
+
+/* Which arena (if any) does 'p' belong to */
+static struct arena *
+arena_of(void *p)
+{
+	struct arena	*a;
+
+	for (a = arenas; a != NULL; a = a->next) {
+		if (((uint8_t *) p >= a->base) && ((uint8_t *) p < a->base + a->size)) {
+			return a;
+		}
+	}
+	return NULL;
+}
+
+static void
+heap_count(void *p, int sign)
+{
+	uint32_t	n;
+
+	if (p == NULL) {
+		return;
+	}
+	n = malloc_usable_size(p);
+	if (sign > 0) {
+		heap_live += n;
+		heap_blocks++;
+		if (heap_live > heap_peak) {
+			heap_peak = heap_live;
+		}
+	} else {
+		heap_live -= n;
+		heap_blocks--;
+	}
+}
+
+void *
+__wrap_malloc(size_t size)
+{
+	void	*p;
+
+	if ((current != NULL) && ((p = arena_alloc(current, size)) != NULL)) {
+		return p;
+	}
+	p = __real_malloc(size);
+	heap_count(p, 1);
+	return p;
+}
+
+void *
+__wrap_calloc(size_t n, size_t size)
+{
+	void	*p;
+
+	if ((current != NULL) && (size != 0) && (n <= UINT32_MAX / size) &&
+		((p = arena_alloc(current, n * size)) != NULL)) {
+		/* arena_reset() doesn't clear anything */
+		memset(p, 0, n * size);
+		return p;
+	}
+	p = __real_calloc(n, size);
+	heap_count(p, 1);
+	return p;
+}
+
+void
+__wrap_free(void *p)
+{
+	if ((p == NULL) || (arena_of(p) != NULL)) {
+		return;
+	}
+	heap_count(p, -1);
+	__real_free(p);
+}
+
+/*
+ * Arena blocks are grown in place if they were the last one handed
+ * out, otherwise copied. Heap blocks stay in the heap.
+ */
+void *
+__wrap_realloc(void *p, size_t size)
+{
+	struct arena	*a;
+	uint32_t		old;
+	void			*np;
+
+	if (p == NULL) {
+		return __wrap_malloc(size);
+	}
+	a = arena_of(p);
+	if (a == NULL) {
+		heap_count(p, -1);
+		np = __real_realloc(p, size);
+		/* a failed realloc leaves the old block where it was */
+		heap_count((np != NULL) ? np : p, 1);
+		return np;
+	}
+	old = *(uint32_t *) ((uint8_t *) p - ARENA_HDR);
+	if (((uint8_t *) p == a->base + a->last + ARENA_HDR) &&
+		(size <= a->size - a->last - ARENA_HDR)) {
+		*(uint32_t *) ((uint8_t *) p - ARENA_HDR) = size;
+		a->used = a->last + ARENA_HDR + ARENA_ROUND(size);
+		if (a->used > a->peak) {
+			a->peak = a->used;
+		}
+		return p;
+	}
+	np = __wrap_malloc(size);
+	if (np != NULL) {
+		memcpy(np, p, (old < size) ? old : size);
+	}
+	return np;
+}
+
+/*
+ * Heap usage, 'live' and 'peak' count what went through malloc() (not
+ * the C library's own reentrant allocations, printf's buffers and
+ * such), the rest comes from the allocator itself. mallinfo() doesn't
+ * say how big the largest free piece is, so how broken up the free
+ * space is shows only as how many pieces it is in.
+ */
+void
+heap_get_stats(struct heap_stats *s)
+{
+	struct mallinfo	mi;
+
+	mi = mallinfo();
+	s->live = heap_live;
+	s->peak = heap_peak;
+	s->blocks = heap_blocks;
+	s->heap = mi.arena;
+	s->free = mi.fordblks;
+	s->free_blocks = mi.ordblks;
+}
+
+void
+heap_reset_peak(void)
+{
+	heap_peak = heap_live;
+}
@@ -99,6 +99,8 @@ void clock_setup(void)
 	systick_set_reload(168000/4);
 	systick_set_clocksource(STK_CSR_CLKSOURCE_AHB);
 	systick_counter_enable();
+	/* Hooks are expected to be short, defer_work() anything heavy */
+	nvic_set_priority(NVIC_SYSTICK_IRQ, IRQ_PRI_SYSTICK);
 
 	/* this done last */
 	systick_interrupt_enable();
@@ -232,7 +232,8 @@ void console_setup(int baud)
 	usart_set_flow_control(CONSOLE_USART, USART_FLOWCONTROL_NONE);
 	usart_enable(CONSOLE_USART);
 
-	/* Enable interrupts from the USART */
+	/* Enable interrupts from the USART, ahead of everything else */
+	nvic_set_priority(CONSOLE_USART_INT, IRQ_PRI_CONSOLE);
 	nvic_enable_irq(CONSOLE_USART_INT);
 
 	/* Specifically enable recieve interrupts */
@@ -0,0 +1,133 @@
+/*
+ * defer.c -- deferred work queue run from PendSV
+ *
+ * Interrupt handlers should capture whatever state they need and get
+ * out. Anything heavy (like clocking 128 pixels into the LED panel)
+ * is queued here with defer_work() and run later from the PendSV
+ * exception. PendSV is set to the lowest priority in the system so
+ * the deferred work can be preempted by every "real" interrupt, in
+ * particular the console USART which otherwise loses characters.
+ *
+ * Each queued item is stamped with the DWT cycle counter so we can
+ * see how long work sits in the queue before it runs.
+ */
+
+#include <stdint.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/cm3/scb.h>
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
+#include "../util/util.h"
+
+/* Must be a power of 2 */
+#define DEFER_QUEUE_SIZE	16
+
+static struct defer_item {
+	void		(*func)(void);
+	uint32_t	stamp;			/* DWT cycle count when queued */
+} defer_queue[DEFER_QUEUE_SIZE];
+
+static volatile uint32_t defer_head;	/* next place to store */
+static volatile uint32_t defer_tail;	/* next item to run */
+
+static struct defer_stats stats;
+static uint64_t lat_total;
+
+/*
+ * Queue up a function to be called from PendSV. This may be called
+ * from any interrupt handler (or from thread mode). Returns 0 if the
+ * work was queued, -1 if the queue was full and the work dropped.
+ */
+int
+defer_work(void (*func)(void))
+{
+	uint32_t	mask;
+	uint32_t	depth;
+
+	mask = cm_mask_interrupts(1);
+	depth = defer_head - defer_tail;
+	if (depth >= DEFER_QUEUE_SIZE) {
+		stats.dropped++;
+		cm_mask_interrupts(mask);
+		return -1;
+	}
+	defer_queue[defer_head & (DEFER_QUEUE_SIZE - 1)].func = func;
+	defer_queue[defer_head & (DEFER_QUEUE_SIZE - 1)].stamp =
+											dwt_read_cycle_counter();
+	defer_head++;
+	stats.posted++;
+	if (++depth > stats.depth_max) {
+		stats.depth_max = depth;
+	}
+	cm_mask_interrupts(mask);
+
+	SCB_ICSR = SCB_ICSR_PENDSVSET;
+	return 0;
+}
+
+/*
+ * PendSV handler, runs everything in the queue. Since we are the
+ * lowest priority exception, nothing else queues while we're between
+ * the read of the head and the tail update except from a higher
+ * priority interrupt, which is fine as it only moves the head.
+ */
+void
+pend_sv_handler(void)
+{
+	struct defer_item	*item;
+	uint32_t			lat;
+
+	while (defer_tail != defer_head) {
+		item = &defer_queue[defer_tail & (DEFER_QUEUE_SIZE - 1)];
+		lat = dwt_read_cycle_counter() - item->stamp;
+		if ((stats.run == 0) || (lat < stats.lat_min)) {
+			stats.lat_min = lat;
+		}
+		if (lat > stats.lat_max) {
+			stats.lat_max = lat;
+		}
+		lat_total += lat;
+		stats.run++;
+		item->func();
+		defer_tail++;
+	}
+}
+
+/*
+ * Copy out the current statistics, latencies are in CPU cycles
+ * (168 per uS).
+ */
+void
+defer_get_stats(struct defer_stats *s)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	*s = stats;
+	s->lat_avg = (stats.run) ? (uint32_t) (lat_total / stats.run) : 0;
+	cm_mask_interrupts(mask);
+}
+
+void
+defer_reset_stats(void)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	stats.posted = stats.dropped = stats.run = 0;
+	stats.lat_min = stats.lat_max = stats.lat_avg = 0;
+	stats.depth_max = 0;
+	lat_total = 0;
+	cm_mask_interrupts(mask);
+}
+
+/*
+ * Set PendSV to the lowest priority and start the cycle counter
+ * we use for time stamps.
+ */
+void
+defer_setup(void)
+{
+	dwt_enable_cycle_counter();
+	nvic_set_priority(NVIC_PENDSV_IRQ, IRQ_PRI_DEFER);
+}
@@ -0,0 +1,1672 @@
+/*
+ * dial.c -- clock face geometry, written by tools/dial_tables.py
+ *
+ * Do not edit, change the script and run it again. See dial.h.
+ */
+
+#include <stdint.h>
+#include "../util/dial.h"
+
+/* 10 long, 1000 steps a turn */
+const struct dial_point dial_ms[1000] = {
+	{ 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 },
+	{ 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 },
+	{ 32, 22 }, { 32, 22 }, { 32, 22 }, { 32, 22 }, { 33, 22 }, { 33, 22 },
+	{ 33, 22 }, { 33, 22 }, { 33, 22 }, { 33, 22 }, { 33, 22 }, { 33, 22 },
+	{ 33, 22 }, { 33, 22 }, { 33, 22 }, { 33, 22 }, { 33, 22 }, { 33, 22 },
+	{ 33, 22 }, { 33, 22 }, { 33, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 },
+	{ 34, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 },
+	{ 34, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 }, { 34, 22 },
+	{ 34, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 },
+	{ 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 },
+	{ 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 }, { 35, 22 },
+	{ 36, 22 }, { 36, 22 }, { 36, 22 }, { 36, 22 }, { 36, 22 }, { 36, 22 },
+	{ 36, 23 }, { 36, 23 }, { 36, 23 }, { 36, 23 }, { 36, 23 }, { 36, 23 },
+	{ 36, 23 }, { 36, 23 }, { 36, 23 }, { 36, 23 }, { 36, 23 }, { 36, 23 },
+	{ 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 },
+	{ 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 },
+	{ 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 }, { 37, 23 },
+	{ 37, 23 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 },
+	{ 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 },
+	{ 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 },
+	{ 38, 24 }, { 38, 24 }, { 38, 24 }, { 38, 24 }, { 39, 24 }, { 39, 24 },
+	{ 39, 24 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 },
+	{ 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 },
+	{ 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 },
+	{ 39, 25 }, { 39, 25 }, { 39, 25 }, { 39, 25 }, { 40, 26 }, { 40, 26 },
+	{ 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 },
+	{ 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 },
+	{ 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 26 }, { 40, 27 },
+	{ 40, 27 }, { 40, 27 }, { 40, 27 }, { 40, 27 }, { 40, 27 }, { 40, 27 },
+	{ 40, 27 }, { 40, 27 }, { 40, 27 }, { 40, 27 }, { 40, 27 }, { 41, 27 },
+	{ 41, 27 }, { 41, 27 }, { 41, 27 }, { 41, 27 }, { 41, 27 }, { 41, 28 },
+	{ 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 },
+	{ 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 },
+	{ 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 28 }, { 41, 29 }, { 41, 29 },
+	{ 41, 29 }, { 41, 29 }, { 41, 29 }, { 41, 29 }, { 41, 29 }, { 41, 29 },
+	{ 41, 29 }, { 41, 29 }, { 41, 29 }, { 41, 29 }, { 41, 29 }, { 41, 29 },
+	{ 41, 29 }, { 41, 29 }, { 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 },
+	{ 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 },
+	{ 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 }, { 41, 30 },
+	{ 41, 30 }, { 41, 31 }, { 41, 31 }, { 41, 31 }, { 41, 31 }, { 41, 31 },
+	{ 41, 31 }, { 41, 31 }, { 41, 31 }, { 41, 31 }, { 41, 31 }, { 41, 31 },
+	{ 41, 31 }, { 41, 31 }, { 41, 31 }, { 41, 31 }, { 42, 32 }, { 41, 32 },
+	{ 41, 32 }, { 41, 32 }, { 41, 32 }, { 41, 32 }, { 41, 32 }, { 41, 32 },
+	{ 41, 32 }, { 41, 32 }, { 41, 32 }, { 41, 32 }, { 41, 32 }, { 41, 32 },
+	{ 41, 32 }, { 41, 32 }, { 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 },
+	{ 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 },
+	{ 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 }, { 41, 33 },
+	{ 41, 33 }, { 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 },
+	{ 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 },
+	{ 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 34 }, { 41, 35 },
+	{ 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 },
+	{ 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 },
+	{ 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 35 }, { 41, 36 }, { 41, 36 },
+	{ 41, 36 }, { 41, 36 }, { 41, 36 }, { 41, 36 }, { 40, 36 }, { 40, 36 },
+	{ 40, 36 }, { 40, 36 }, { 40, 36 }, { 40, 36 }, { 40, 36 }, { 40, 36 },
+	{ 40, 36 }, { 40, 36 }, { 40, 36 }, { 40, 36 }, { 40, 37 }, { 40, 37 },
+	{ 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 },
+	{ 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 },
+	{ 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 }, { 40, 37 }, { 39, 38 },
+	{ 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 },
+	{ 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 },
+	{ 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 }, { 39, 38 },
+	{ 39, 38 }, { 39, 38 }, { 39, 39 }, { 39, 39 }, { 39, 39 }, { 38, 39 },
+	{ 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 },
+	{ 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 },
+	{ 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 }, { 38, 39 },
+	{ 38, 39 }, { 38, 39 }, { 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 },
+	{ 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 },
+	{ 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 }, { 37, 40 },
+	{ 37, 40 }, { 37, 40 }, { 37, 40 }, { 36, 40 }, { 36, 40 }, { 36, 40 },
+	{ 36, 40 }, { 36, 40 }, { 36, 40 }, { 36, 40 }, { 36, 40 }, { 36, 40 },
+	{ 36, 40 }, { 36, 40 }, { 36, 40 }, { 36, 41 }, { 36, 41 }, { 36, 41 },
+	{ 36, 41 }, { 36, 41 }, { 36, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 },
+	{ 35, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 },
+	{ 35, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 }, { 35, 41 },
+	{ 35, 41 }, { 35, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 },
+	{ 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 },
+	{ 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 }, { 34, 41 },
+	{ 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 },
+	{ 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 },
+	{ 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 }, { 33, 41 }, { 32, 41 },
+	{ 32, 41 }, { 32, 41 }, { 32, 41 }, { 32, 41 }, { 32, 41 }, { 32, 41 },
+	{ 32, 41 }, { 32, 41 }, { 32, 41 }, { 32, 41 }, { 32, 41 }, { 32, 41 },
+	{ 32, 41 }, { 32, 41 }, { 32, 42 }, { 31, 41 }, { 31, 41 }, { 31, 41 },
+	{ 31, 41 }, { 31, 41 }, { 31, 41 }, { 31, 41 }, { 31, 41 }, { 31, 41 },
+	{ 31, 41 }, { 31, 41 }, { 31, 41 }, { 31, 41 }, { 31, 41 }, { 31, 41 },
+	{ 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 },
+	{ 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 },
+	{ 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 }, { 30, 41 }, { 29, 41 },
+	{ 29, 41 }, { 29, 41 }, { 29, 41 }, { 29, 41 }, { 29, 41 }, { 29, 41 },
+	{ 29, 41 }, { 29, 41 }, { 29, 41 }, { 29, 41 }, { 29, 41 }, { 29, 41 },
+	{ 29, 41 }, { 29, 41 }, { 29, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 },
+	{ 28, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 },
+	{ 28, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 }, { 28, 41 },
+	{ 28, 41 }, { 28, 41 }, { 27, 41 }, { 27, 41 }, { 27, 41 }, { 27, 41 },
+	{ 27, 41 }, { 27, 41 }, { 27, 40 }, { 27, 40 }, { 27, 40 }, { 27, 40 },
+	{ 27, 40 }, { 27, 40 }, { 27, 40 }, { 27, 40 }, { 27, 40 }, { 27, 40 },
+	{ 27, 40 }, { 27, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 },
+	{ 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 },
+	{ 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 }, { 26, 40 },
+	{ 26, 40 }, { 26, 40 }, { 26, 40 }, { 25, 39 }, { 25, 39 }, { 25, 39 },
+	{ 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 },
+	{ 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 },
+	{ 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 }, { 25, 39 },
+	{ 24, 39 }, { 24, 39 }, { 24, 39 }, { 24, 38 }, { 24, 38 }, { 24, 38 },
+	{ 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 },
+	{ 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 },
+	{ 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 }, { 24, 38 },
+	{ 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 },
+	{ 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 },
+	{ 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 }, { 23, 37 },
+	{ 23, 37 }, { 23, 36 }, { 23, 36 }, { 23, 36 }, { 23, 36 }, { 23, 36 },
+	{ 23, 36 }, { 23, 36 }, { 23, 36 }, { 23, 36 }, { 23, 36 }, { 23, 36 },
+	{ 23, 36 }, { 22, 36 }, { 22, 36 }, { 22, 36 }, { 22, 36 }, { 22, 36 },
+	{ 22, 36 }, { 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 },
+	{ 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 },
+	{ 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 }, { 22, 35 },
+	{ 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 },
+	{ 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 },
+	{ 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 34 }, { 22, 33 }, { 22, 33 },
+	{ 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 33 },
+	{ 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 33 },
+	{ 22, 33 }, { 22, 33 }, { 22, 33 }, { 22, 32 }, { 22, 32 }, { 22, 32 },
+	{ 22, 32 }, { 22, 32 }, { 22, 32 }, { 22, 32 }, { 22, 32 }, { 22, 32 },
+	{ 22, 32 }, { 22, 32 }, { 22, 32 }, { 22, 32 }, { 22, 32 }, { 22, 32 },
+	{ 22, 32 }, { 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 31 },
+	{ 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 31 },
+	{ 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 31 }, { 22, 30 }, { 22, 30 },
+	{ 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 30 },
+	{ 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 30 },
+	{ 22, 30 }, { 22, 30 }, { 22, 30 }, { 22, 29 }, { 22, 29 }, { 22, 29 },
+	{ 22, 29 }, { 22, 29 }, { 22, 29 }, { 22, 29 }, { 22, 29 }, { 22, 29 },
+	{ 22, 29 }, { 22, 29 }, { 22, 29 }, { 22, 29 }, { 22, 29 }, { 22, 29 },
+	{ 22, 29 }, { 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 },
+	{ 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 },
+	{ 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 }, { 22, 28 },
+	{ 22, 27 }, { 22, 27 }, { 22, 27 }, { 22, 27 }, { 22, 27 }, { 22, 27 },
+	{ 23, 27 }, { 23, 27 }, { 23, 27 }, { 23, 27 }, { 23, 27 }, { 23, 27 },
+	{ 23, 27 }, { 23, 27 }, { 23, 27 }, { 23, 27 }, { 23, 27 }, { 23, 27 },
+	{ 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 },
+	{ 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 },
+	{ 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 }, { 23, 26 },
+	{ 23, 26 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 },
+	{ 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 },
+	{ 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 },
+	{ 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 25 }, { 24, 24 }, { 24, 24 },
+	{ 24, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 },
+	{ 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 },
+	{ 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 },
+	{ 25, 24 }, { 25, 24 }, { 25, 24 }, { 25, 24 }, { 26, 23 }, { 26, 23 },
+	{ 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 },
+	{ 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 },
+	{ 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 }, { 26, 23 }, { 27, 23 },
+	{ 27, 23 }, { 27, 23 }, { 27, 23 }, { 27, 23 }, { 27, 23 }, { 27, 23 },
+	{ 27, 23 }, { 27, 23 }, { 27, 23 }, { 27, 23 }, { 27, 23 }, { 27, 22 },
+	{ 27, 22 }, { 27, 22 }, { 27, 22 }, { 27, 22 }, { 27, 22 }, { 28, 22 },
+	{ 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 },
+	{ 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 },
+	{ 28, 22 }, { 28, 22 }, { 28, 22 }, { 28, 22 }, { 29, 22 }, { 29, 22 },
+	{ 29, 22 }, { 29, 22 }, { 29, 22 }, { 29, 22 }, { 29, 22 }, { 29, 22 },
+	{ 29, 22 }, { 29, 22 }, { 29, 22 }, { 29, 22 }, { 29, 22 }, { 29, 22 },
+	{ 29, 22 }, { 29, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 },
+	{ 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 },
+	{ 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 }, { 30, 22 },
+	{ 30, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 },
+	{ 31, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 },
+	{ 31, 22 }, { 31, 22 }, { 31, 22 }, { 31, 22 },
+};
+
+/* 25 long, 3600 steps a turn */
+const struct dial_point dial_sec[3600] = {
+	{ 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 },
+	{ 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 },
+	{ 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 },
+	{ 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 32,  7 }, { 33,  7 },
+	{ 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 },
+	{ 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 },
+	{ 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 },
+	{ 33,  7 }, { 33,  7 }, { 33,  7 }, { 33,  7 }, { 34,  7 }, { 34,  7 },
+	{ 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 },
+	{ 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 },
+	{ 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 }, { 34,  7 },
+	{ 34,  7 }, { 34,  7 }, { 34,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 },
+	{ 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 },
+	{ 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 },
+	{ 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 }, { 35,  7 },
+	{ 35,  7 }, { 35,  7 }, { 35,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 },
+	{ 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 },
+	{ 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 },
+	{ 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 }, { 36,  7 },
+	{ 36,  7 }, { 36,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 },
+	{ 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 },
+	{ 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 },
+	{ 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 }, { 37,  7 },
+	{ 37,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 },
+	{ 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 },
+	{ 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 },
+	{ 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 }, { 38,  7 },
+	{ 38,  7 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 },
+	{ 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 },
+	{ 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 },
+	{ 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 }, { 39,  8 },
+	{ 39,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 },
+	{ 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 },
+	{ 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 },
+	{ 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 }, { 40,  8 },
+	{ 40,  8 }, { 40,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 },
+	{ 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 },
+	{ 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  8 },
+	{ 41,  8 }, { 41,  8 }, { 41,  8 }, { 41,  9 }, { 41,  9 }, { 41,  9 },
+	{ 41,  9 }, { 41,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 },
+	{ 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 },
+	{ 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 },
+	{ 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 },
+	{ 42,  9 }, { 42,  9 }, { 42,  9 }, { 42,  9 }, { 43,  9 }, { 43,  9 },
+	{ 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 },
+	{ 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 },
+	{ 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 }, { 43,  9 },
+	{ 43,  9 }, { 43,  9 }, { 43, 10 }, { 43, 10 }, { 43, 10 }, { 44, 10 },
+	{ 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 },
+	{ 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 },
+	{ 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 },
+	{ 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 }, { 44, 10 },
+	{ 44, 10 }, { 44, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 },
+	{ 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 },
+	{ 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 10 }, { 45, 11 },
+	{ 45, 11 }, { 45, 11 }, { 45, 11 }, { 45, 11 }, { 45, 11 }, { 45, 11 },
+	{ 45, 11 }, { 45, 11 }, { 45, 11 }, { 45, 11 }, { 45, 11 }, { 46, 11 },
+	{ 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 },
+	{ 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 },
+	{ 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 },
+	{ 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 }, { 46, 11 },
+	{ 46, 11 }, { 46, 11 }, { 46, 11 }, { 47, 12 }, { 47, 12 }, { 47, 12 },
+	{ 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 },
+	{ 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 },
+	{ 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 },
+	{ 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 }, { 47, 12 },
+	{ 47, 12 }, { 47, 12 }, { 48, 12 }, { 48, 12 }, { 48, 12 }, { 48, 12 },
+	{ 48, 12 }, { 48, 12 }, { 48, 12 }, { 48, 12 }, { 48, 13 }, { 48, 13 },
+	{ 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 },
+	{ 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 },
+	{ 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 }, { 48, 13 },
+	{ 48, 13 }, { 48, 13 }, { 48, 13 }, { 49, 13 }, { 49, 13 }, { 49, 13 },
+	{ 49, 13 }, { 49, 13 }, { 49, 13 }, { 49, 13 }, { 49, 13 }, { 49, 13 },
+	{ 49, 13 }, { 49, 13 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 },
+	{ 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 },
+	{ 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 },
+	{ 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 49, 14 }, { 50, 14 },
+	{ 50, 14 }, { 50, 14 }, { 50, 14 }, { 50, 14 }, { 50, 14 }, { 50, 14 },
+	{ 50, 14 }, { 50, 14 }, { 50, 14 }, { 50, 14 }, { 50, 15 }, { 50, 15 },
+	{ 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 },
+	{ 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 },
+	{ 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 }, { 50, 15 },
+	{ 50, 15 }, { 50, 15 }, { 50, 15 }, { 51, 15 }, { 51, 15 }, { 51, 15 },
+	{ 51, 15 }, { 51, 15 }, { 51, 15 }, { 51, 15 }, { 51, 15 }, { 51, 16 },
+	{ 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 },
+	{ 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 },
+	{ 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 },
+	{ 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 },
+	{ 51, 16 }, { 51, 16 }, { 51, 16 }, { 51, 16 }, { 52, 17 }, { 52, 17 },
+	{ 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 },
+	{ 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 },
+	{ 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 },
+	{ 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 }, { 52, 17 },
+	{ 52, 17 }, { 52, 17 }, { 52, 18 }, { 52, 18 }, { 52, 18 }, { 52, 18 },
+	{ 52, 18 }, { 52, 18 }, { 52, 18 }, { 52, 18 }, { 52, 18 }, { 52, 18 },
+	{ 52, 18 }, { 52, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 },
+	{ 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 },
+	{ 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 18 }, { 53, 19 },
+	{ 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 },
+	{ 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 },
+	{ 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 },
+	{ 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 }, { 53, 19 },
+	{ 53, 19 }, { 53, 19 }, { 53, 20 }, { 53, 20 }, { 53, 20 }, { 54, 20 },
+	{ 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 },
+	{ 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 },
+	{ 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 20 },
+	{ 54, 20 }, { 54, 20 }, { 54, 20 }, { 54, 21 }, { 54, 21 }, { 54, 21 },
+	{ 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 },
+	{ 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 },
+	{ 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 },
+	{ 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 21 }, { 54, 22 },
+	{ 54, 22 }, { 54, 22 }, { 54, 22 }, { 54, 22 }, { 55, 22 }, { 55, 22 },
+	{ 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 },
+	{ 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 },
+	{ 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 22 }, { 55, 23 },
+	{ 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 },
+	{ 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 },
+	{ 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 },
+	{ 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 }, { 55, 23 },
+	{ 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 },
+	{ 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 },
+	{ 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 },
+	{ 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 }, { 55, 24 },
+	{ 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 },
+	{ 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 },
+	{ 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 },
+	{ 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 }, { 56, 25 },
+	{ 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 },
+	{ 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 },
+	{ 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 },
+	{ 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 26 }, { 56, 27 },
+	{ 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 },
+	{ 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 },
+	{ 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 },
+	{ 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 27 }, { 56, 28 }, { 56, 28 },
+	{ 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 },
+	{ 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 },
+	{ 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 },
+	{ 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 28 }, { 56, 29 }, { 56, 29 },
+	{ 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 },
+	{ 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 },
+	{ 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 29 },
+	{ 56, 29 }, { 56, 29 }, { 56, 29 }, { 56, 30 }, { 56, 30 }, { 56, 30 },
+	{ 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 },
+	{ 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 },
+	{ 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 }, { 56, 30 },
+	{ 56, 30 }, { 56, 30 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 },
+	{ 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 },
+	{ 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 },
+	{ 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 }, { 56, 31 },
+	{ 57, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 },
+	{ 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 },
+	{ 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 },
+	{ 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 32 }, { 56, 33 },
+	{ 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 },
+	{ 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 },
+	{ 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 },
+	{ 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 33 }, { 56, 34 }, { 56, 34 },
+	{ 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 },
+	{ 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 },
+	{ 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 34 },
+	{ 56, 34 }, { 56, 34 }, { 56, 34 }, { 56, 35 }, { 56, 35 }, { 56, 35 },
+	{ 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 },
+	{ 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 },
+	{ 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 35 },
+	{ 56, 35 }, { 56, 35 }, { 56, 35 }, { 56, 36 }, { 56, 36 }, { 56, 36 },
+	{ 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 },
+	{ 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 },
+	{ 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 }, { 56, 36 },
+	{ 56, 36 }, { 56, 36 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 },
+	{ 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 },
+	{ 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 },
+	{ 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 }, { 56, 37 },
+	{ 56, 37 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 },
+	{ 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 },
+	{ 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 },
+	{ 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 }, { 56, 38 },
+	{ 56, 38 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 },
+	{ 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 },
+	{ 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 },
+	{ 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 }, { 55, 39 },
+	{ 55, 39 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 },
+	{ 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 },
+	{ 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 },
+	{ 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 }, { 55, 40 },
+	{ 55, 40 }, { 55, 40 }, { 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 },
+	{ 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 },
+	{ 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 }, { 55, 41 },
+	{ 55, 41 }, { 55, 41 }, { 55, 41 }, { 54, 41 }, { 54, 41 }, { 54, 41 },
+	{ 54, 41 }, { 54, 41 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 },
+	{ 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 },
+	{ 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 },
+	{ 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 },
+	{ 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 42 }, { 54, 43 }, { 54, 43 },
+	{ 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 },
+	{ 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 },
+	{ 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 }, { 54, 43 },
+	{ 54, 43 }, { 54, 43 }, { 53, 43 }, { 53, 43 }, { 53, 43 }, { 53, 44 },
+	{ 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 },
+	{ 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 },
+	{ 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 },
+	{ 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 }, { 53, 44 },
+	{ 53, 44 }, { 53, 44 }, { 53, 45 }, { 53, 45 }, { 53, 45 }, { 53, 45 },
+	{ 53, 45 }, { 53, 45 }, { 53, 45 }, { 53, 45 }, { 53, 45 }, { 53, 45 },
+	{ 53, 45 }, { 53, 45 }, { 53, 45 }, { 53, 45 }, { 53, 45 }, { 52, 45 },
+	{ 52, 45 }, { 52, 45 }, { 52, 45 }, { 52, 45 }, { 52, 45 }, { 52, 45 },
+	{ 52, 45 }, { 52, 45 }, { 52, 45 }, { 52, 45 }, { 52, 45 }, { 52, 46 },
+	{ 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 },
+	{ 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 },
+	{ 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 },
+	{ 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 }, { 52, 46 },
+	{ 52, 46 }, { 52, 46 }, { 52, 46 }, { 51, 47 }, { 51, 47 }, { 51, 47 },
+	{ 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 },
+	{ 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 },
+	{ 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 },
+	{ 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 }, { 51, 47 },
+	{ 51, 47 }, { 51, 47 }, { 51, 48 }, { 51, 48 }, { 51, 48 }, { 51, 48 },
+	{ 51, 48 }, { 51, 48 }, { 51, 48 }, { 51, 48 }, { 50, 48 }, { 50, 48 },
+	{ 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 },
+	{ 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 },
+	{ 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 48 },
+	{ 50, 48 }, { 50, 48 }, { 50, 48 }, { 50, 49 }, { 50, 49 }, { 50, 49 },
+	{ 50, 49 }, { 50, 49 }, { 50, 49 }, { 50, 49 }, { 50, 49 }, { 50, 49 },
+	{ 50, 49 }, { 50, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 },
+	{ 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 },
+	{ 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 },
+	{ 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 49 }, { 49, 50 },
+	{ 49, 50 }, { 49, 50 }, { 49, 50 }, { 49, 50 }, { 49, 50 }, { 49, 50 },
+	{ 49, 50 }, { 49, 50 }, { 49, 50 }, { 49, 50 }, { 48, 50 }, { 48, 50 },
+	{ 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 },
+	{ 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 },
+	{ 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 50 },
+	{ 48, 50 }, { 48, 50 }, { 48, 50 }, { 48, 51 }, { 48, 51 }, { 48, 51 },
+	{ 48, 51 }, { 48, 51 }, { 48, 51 }, { 48, 51 }, { 48, 51 }, { 47, 51 },
+	{ 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 },
+	{ 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 },
+	{ 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 },
+	{ 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 },
+	{ 47, 51 }, { 47, 51 }, { 47, 51 }, { 47, 51 }, { 46, 52 }, { 46, 52 },
+	{ 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 },
+	{ 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 },
+	{ 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 },
+	{ 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 }, { 46, 52 },
+	{ 46, 52 }, { 46, 52 }, { 45, 52 }, { 45, 52 }, { 45, 52 }, { 45, 52 },
+	{ 45, 52 }, { 45, 52 }, { 45, 52 }, { 45, 52 }, { 45, 52 }, { 45, 52 },
+	{ 45, 52 }, { 45, 52 }, { 45, 53 }, { 45, 53 }, { 45, 53 }, { 45, 53 },
+	{ 45, 53 }, { 45, 53 }, { 45, 53 }, { 45, 53 }, { 45, 53 }, { 45, 53 },
+	{ 45, 53 }, { 45, 53 }, { 45, 53 }, { 45, 53 }, { 45, 53 }, { 44, 53 },
+	{ 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 },
+	{ 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 },
+	{ 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 },
+	{ 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 }, { 44, 53 },
+	{ 44, 53 }, { 44, 53 }, { 43, 53 }, { 43, 53 }, { 43, 53 }, { 43, 54 },
+	{ 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 },
+	{ 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 },
+	{ 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 }, { 43, 54 },
+	{ 43, 54 }, { 43, 54 }, { 43, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 },
+	{ 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 },
+	{ 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 },
+	{ 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 },
+	{ 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 42, 54 }, { 41, 54 },
+	{ 41, 54 }, { 41, 54 }, { 41, 54 }, { 41, 54 }, { 41, 55 }, { 41, 55 },
+	{ 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 },
+	{ 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 },
+	{ 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 }, { 41, 55 }, { 40, 55 },
+	{ 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 },
+	{ 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 },
+	{ 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 },
+	{ 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 }, { 40, 55 },
+	{ 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 },
+	{ 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 },
+	{ 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 },
+	{ 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 }, { 39, 55 },
+	{ 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 },
+	{ 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 },
+	{ 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 },
+	{ 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 }, { 38, 56 },
+	{ 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 },
+	{ 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 },
+	{ 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 },
+	{ 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 37, 56 }, { 36, 56 },
+	{ 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 },
+	{ 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 },
+	{ 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 },
+	{ 36, 56 }, { 36, 56 }, { 36, 56 }, { 36, 56 }, { 35, 56 }, { 35, 56 },
+	{ 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 },
+	{ 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 },
+	{ 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 },
+	{ 35, 56 }, { 35, 56 }, { 35, 56 }, { 35, 56 }, { 34, 56 }, { 34, 56 },
+	{ 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 },
+	{ 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 },
+	{ 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 }, { 34, 56 },
+	{ 34, 56 }, { 34, 56 }, { 34, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 },
+	{ 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 },
+	{ 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 },
+	{ 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 }, { 33, 56 },
+	{ 33, 56 }, { 33, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 },
+	{ 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 },
+	{ 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 },
+	{ 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 }, { 32, 56 },
+	{ 32, 57 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 },
+	{ 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 },
+	{ 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 },
+	{ 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 31, 56 }, { 30, 56 },
+	{ 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 },
+	{ 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 },
+	{ 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 },
+	{ 30, 56 }, { 30, 56 }, { 30, 56 }, { 30, 56 }, { 29, 56 }, { 29, 56 },
+	{ 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 },
+	{ 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 },
+	{ 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 }, { 29, 56 },
+	{ 29, 56 }, { 29, 56 }, { 29, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 },
+	{ 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 },
+	{ 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 },
+	{ 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 }, { 28, 56 },
+	{ 28, 56 }, { 28, 56 }, { 28, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 },
+	{ 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 },
+	{ 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 },
+	{ 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 }, { 27, 56 },
+	{ 27, 56 }, { 27, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 },
+	{ 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 },
+	{ 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 },
+	{ 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 }, { 26, 56 },
+	{ 26, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 },
+	{ 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 },
+	{ 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 },
+	{ 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 }, { 25, 56 },
+	{ 25, 56 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 },
+	{ 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 },
+	{ 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 },
+	{ 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 }, { 24, 55 },
+	{ 24, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 },
+	{ 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 },
+	{ 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 },
+	{ 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 }, { 23, 55 },
+	{ 23, 55 }, { 23, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 },
+	{ 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 },
+	{ 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 55 },
+	{ 22, 55 }, { 22, 55 }, { 22, 55 }, { 22, 54 }, { 22, 54 }, { 22, 54 },
+	{ 22, 54 }, { 22, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 },
+	{ 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 },
+	{ 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 },
+	{ 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 },
+	{ 21, 54 }, { 21, 54 }, { 21, 54 }, { 21, 54 }, { 20, 54 }, { 20, 54 },
+	{ 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 },
+	{ 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 },
+	{ 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 }, { 20, 54 },
+	{ 20, 54 }, { 20, 54 }, { 20, 53 }, { 20, 53 }, { 20, 53 }, { 19, 53 },
+	{ 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 },
+	{ 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 },
+	{ 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 },
+	{ 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 }, { 19, 53 },
+	{ 19, 53 }, { 19, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 },
+	{ 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 },
+	{ 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 53 }, { 18, 52 },
+	{ 18, 52 }, { 18, 52 }, { 18, 52 }, { 18, 52 }, { 18, 52 }, { 18, 52 },
+	{ 18, 52 }, { 18, 52 }, { 18, 52 }, { 18, 52 }, { 18, 52 }, { 17, 52 },
+	{ 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 },
+	{ 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 },
+	{ 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 },
+	{ 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 }, { 17, 52 },
+	{ 17, 52 }, { 17, 52 }, { 17, 52 }, { 16, 51 }, { 16, 51 }, { 16, 51 },
+	{ 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 },
+	{ 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 },
+	{ 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 },
+	{ 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 }, { 16, 51 },
+	{ 16, 51 }, { 16, 51 }, { 15, 51 }, { 15, 51 }, { 15, 51 }, { 15, 51 },
+	{ 15, 51 }, { 15, 51 }, { 15, 51 }, { 15, 51 }, { 15, 50 }, { 15, 50 },
+	{ 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 },
+	{ 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 },
+	{ 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 }, { 15, 50 },
+	{ 15, 50 }, { 15, 50 }, { 15, 50 }, { 14, 50 }, { 14, 50 }, { 14, 50 },
+	{ 14, 50 }, { 14, 50 }, { 14, 50 }, { 14, 50 }, { 14, 50 }, { 14, 50 },
+	{ 14, 50 }, { 14, 50 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 },
+	{ 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 },
+	{ 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 },
+	{ 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 14, 49 }, { 13, 49 },
+	{ 13, 49 }, { 13, 49 }, { 13, 49 }, { 13, 49 }, { 13, 49 }, { 13, 49 },
+	{ 13, 49 }, { 13, 49 }, { 13, 49 }, { 13, 49 }, { 13, 48 }, { 13, 48 },
+	{ 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 },
+	{ 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 },
+	{ 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 }, { 13, 48 },
+	{ 13, 48 }, { 13, 48 }, { 13, 48 }, { 12, 48 }, { 12, 48 }, { 12, 48 },
+	{ 12, 48 }, { 12, 48 }, { 12, 48 }, { 12, 48 }, { 12, 48 }, { 12, 47 },
+	{ 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 },
+	{ 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 },
+	{ 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 },
+	{ 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 },
+	{ 12, 47 }, { 12, 47 }, { 12, 47 }, { 12, 47 }, { 11, 46 }, { 11, 46 },
+	{ 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 },
+	{ 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 },
+	{ 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 },
+	{ 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 }, { 11, 46 },
+	{ 11, 46 }, { 11, 46 }, { 11, 45 }, { 11, 45 }, { 11, 45 }, { 11, 45 },
+	{ 11, 45 }, { 11, 45 }, { 11, 45 }, { 11, 45 }, { 11, 45 }, { 11, 45 },
+	{ 11, 45 }, { 11, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 },
+	{ 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 },
+	{ 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 45 }, { 10, 44 },
+	{ 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 },
+	{ 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 },
+	{ 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 },
+	{ 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 }, { 10, 44 },
+	{ 10, 44 }, { 10, 44 }, { 10, 43 }, { 10, 43 }, { 10, 43 }, {  9, 43 },
+	{  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 },
+	{  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 },
+	{  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 43 },
+	{  9, 43 }, {  9, 43 }, {  9, 43 }, {  9, 42 }, {  9, 42 }, {  9, 42 },
+	{  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 },
+	{  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 },
+	{  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 },
+	{  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 42 }, {  9, 41 },
+	{  9, 41 }, {  9, 41 }, {  9, 41 }, {  9, 41 }, {  8, 41 }, {  8, 41 },
+	{  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 },
+	{  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 },
+	{  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 41 }, {  8, 40 },
+	{  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 },
+	{  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 },
+	{  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 },
+	{  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 }, {  8, 40 },
+	{  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 },
+	{  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 },
+	{  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 },
+	{  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 }, {  8, 39 },
+	{  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 },
+	{  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 },
+	{  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 },
+	{  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 }, {  7, 38 },
+	{  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 },
+	{  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 },
+	{  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 },
+	{  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 37 }, {  7, 36 },
+	{  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 },
+	{  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 },
+	{  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 },
+	{  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 36 }, {  7, 35 }, {  7, 35 },
+	{  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 },
+	{  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 },
+	{  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 },
+	{  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 35 }, {  7, 34 }, {  7, 34 },
+	{  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 },
+	{  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 },
+	{  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 34 },
+	{  7, 34 }, {  7, 34 }, {  7, 34 }, {  7, 33 }, {  7, 33 }, {  7, 33 },
+	{  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 },
+	{  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 },
+	{  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 }, {  7, 33 },
+	{  7, 33 }, {  7, 33 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 },
+	{  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 },
+	{  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 },
+	{  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 }, {  7, 32 },
+	{  7, 32 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 },
+	{  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 },
+	{  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 },
+	{  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 31 }, {  7, 30 },
+	{  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 },
+	{  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 },
+	{  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 },
+	{  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 30 }, {  7, 29 }, {  7, 29 },
+	{  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 },
+	{  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 },
+	{  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 29 },
+	{  7, 29 }, {  7, 29 }, {  7, 29 }, {  7, 28 }, {  7, 28 }, {  7, 28 },
+	{  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 },
+	{  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 },
+	{  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 28 },
+	{  7, 28 }, {  7, 28 }, {  7, 28 }, {  7, 27 }, {  7, 27 }, {  7, 27 },
+	{  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 },
+	{  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 },
+	{  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 }, {  7, 27 },
+	{  7, 27 }, {  7, 27 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 },
+	{  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 },
+	{  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 },
+	{  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 }, {  7, 26 },
+	{  7, 26 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 },
+	{  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 },
+	{  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 },
+	{  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 }, {  7, 25 },
+	{  7, 25 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 },
+	{  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 },
+	{  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 },
+	{  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 }, {  8, 24 },
+	{  8, 24 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 },
+	{  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 },
+	{  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 },
+	{  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 }, {  8, 23 },
+	{  8, 23 }, {  8, 23 }, {  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 },
+	{  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 },
+	{  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 }, {  8, 22 },
+	{  8, 22 }, {  8, 22 }, {  8, 22 }, {  9, 22 }, {  9, 22 }, {  9, 22 },
+	{  9, 22 }, {  9, 22 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 },
+	{  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 },
+	{  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 },
+	{  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 },
+	{  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 21 }, {  9, 20 }, {  9, 20 },
+	{  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 },
+	{  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 },
+	{  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 }, {  9, 20 },
+	{  9, 20 }, {  9, 20 }, { 10, 20 }, { 10, 20 }, { 10, 20 }, { 10, 19 },
+	{ 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 },
+	{ 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 },
+	{ 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 },
+	{ 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 }, { 10, 19 },
+	{ 10, 19 }, { 10, 19 }, { 10, 18 }, { 10, 18 }, { 10, 18 }, { 10, 18 },
+	{ 10, 18 }, { 10, 18 }, { 10, 18 }, { 10, 18 }, { 10, 18 }, { 10, 18 },
+	{ 10, 18 }, { 10, 18 }, { 10, 18 }, { 10, 18 }, { 10, 18 }, { 11, 18 },
+	{ 11, 18 }, { 11, 18 }, { 11, 18 }, { 11, 18 }, { 11, 18 }, { 11, 18 },
+	{ 11, 18 }, { 11, 18 }, { 11, 18 }, { 11, 18 }, { 11, 18 }, { 11, 17 },
+	{ 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 },
+	{ 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 },
+	{ 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 },
+	{ 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 }, { 11, 17 },
+	{ 11, 17 }, { 11, 17 }, { 11, 17 }, { 12, 16 }, { 12, 16 }, { 12, 16 },
+	{ 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 },
+	{ 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 },
+	{ 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 },
+	{ 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 }, { 12, 16 },
+	{ 12, 16 }, { 12, 16 }, { 12, 15 }, { 12, 15 }, { 12, 15 }, { 12, 15 },
+	{ 12, 15 }, { 12, 15 }, { 12, 15 }, { 12, 15 }, { 13, 15 }, { 13, 15 },
+	{ 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 },
+	{ 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 },
+	{ 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 15 },
+	{ 13, 15 }, { 13, 15 }, { 13, 15 }, { 13, 14 }, { 13, 14 }, { 13, 14 },
+	{ 13, 14 }, { 13, 14 }, { 13, 14 }, { 13, 14 }, { 13, 14 }, { 13, 14 },
+	{ 13, 14 }, { 13, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 },
+	{ 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 },
+	{ 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 },
+	{ 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 14 }, { 14, 13 },
+	{ 14, 13 }, { 14, 13 }, { 14, 13 }, { 14, 13 }, { 14, 13 }, { 14, 13 },
+	{ 14, 13 }, { 14, 13 }, { 14, 13 }, { 14, 13 }, { 15, 13 }, { 15, 13 },
+	{ 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 },
+	{ 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 },
+	{ 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 13 },
+	{ 15, 13 }, { 15, 13 }, { 15, 13 }, { 15, 12 }, { 15, 12 }, { 15, 12 },
+	{ 15, 12 }, { 15, 12 }, { 15, 12 }, { 15, 12 }, { 15, 12 }, { 16, 12 },
+	{ 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 },
+	{ 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 },
+	{ 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 },
+	{ 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 },
+	{ 16, 12 }, { 16, 12 }, { 16, 12 }, { 16, 12 }, { 17, 11 }, { 17, 11 },
+	{ 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 },
+	{ 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 },
+	{ 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 },
+	{ 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 }, { 17, 11 },
+	{ 17, 11 }, { 17, 11 }, { 18, 11 }, { 18, 11 }, { 18, 11 }, { 18, 11 },
+	{ 18, 11 }, { 18, 11 }, { 18, 11 }, { 18, 11 }, { 18, 11 }, { 18, 11 },
+	{ 18, 11 }, { 18, 11 }, { 18, 10 }, { 18, 10 }, { 18, 10 }, { 18, 10 },
+	{ 18, 10 }, { 18, 10 }, { 18, 10 }, { 18, 10 }, { 18, 10 }, { 18, 10 },
+	{ 18, 10 }, { 18, 10 }, { 18, 10 }, { 18, 10 }, { 18, 10 }, { 19, 10 },
+	{ 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 },
+	{ 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 },
+	{ 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 },
+	{ 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 }, { 19, 10 },
+	{ 19, 10 }, { 19, 10 }, { 20, 10 }, { 20, 10 }, { 20, 10 }, { 20,  9 },
+	{ 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 },
+	{ 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 },
+	{ 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 }, { 20,  9 },
+	{ 20,  9 }, { 20,  9 }, { 20,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 },
+	{ 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 },
+	{ 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 },
+	{ 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 },
+	{ 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 21,  9 }, { 22,  9 },
+	{ 22,  9 }, { 22,  9 }, { 22,  9 }, { 22,  9 }, { 22,  8 }, { 22,  8 },
+	{ 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 },
+	{ 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 },
+	{ 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 }, { 22,  8 }, { 23,  8 },
+	{ 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 },
+	{ 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 },
+	{ 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 },
+	{ 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 }, { 23,  8 },
+	{ 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 },
+	{ 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 },
+	{ 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 },
+	{ 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 }, { 24,  8 },
+	{ 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 },
+	{ 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 },
+	{ 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 },
+	{ 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 }, { 25,  7 },
+	{ 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 },
+	{ 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 },
+	{ 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 },
+	{ 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 26,  7 }, { 27,  7 },
+	{ 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 },
+	{ 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 },
+	{ 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 },
+	{ 27,  7 }, { 27,  7 }, { 27,  7 }, { 27,  7 }, { 28,  7 }, { 28,  7 },
+	{ 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 },
+	{ 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 },
+	{ 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 },
+	{ 28,  7 }, { 28,  7 }, { 28,  7 }, { 28,  7 }, { 29,  7 }, { 29,  7 },
+	{ 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 },
+	{ 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 },
+	{ 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 }, { 29,  7 },
+	{ 29,  7 }, { 29,  7 }, { 29,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 },
+	{ 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 },
+	{ 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 },
+	{ 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 }, { 30,  7 },
+	{ 30,  7 }, { 30,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 },
+	{ 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 },
+	{ 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 },
+	{ 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 }, { 31,  7 },
+};
+
+/* 20 long, 3600 steps a turn */
+const struct dial_point dial_min[3600] = {
+	{ 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 },
+	{ 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 },
+	{ 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 },
+	{ 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 },
+	{ 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 32, 12 }, { 33, 12 },
+	{ 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 },
+	{ 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 },
+	{ 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 },
+	{ 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 },
+	{ 33, 12 }, { 33, 12 }, { 33, 12 }, { 33, 12 }, { 34, 12 }, { 34, 12 },
+	{ 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 },
+	{ 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 },
+	{ 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 },
+	{ 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 }, { 34, 12 },
+	{ 34, 12 }, { 34, 12 }, { 34, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 },
+	{ 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 },
+	{ 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 },
+	{ 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 },
+	{ 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 }, { 35, 12 },
+	{ 35, 12 }, { 35, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 },
+	{ 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 },
+	{ 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 },
+	{ 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 },
+	{ 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 }, { 36, 12 },
+	{ 36, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 },
+	{ 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 },
+	{ 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 },
+	{ 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 },
+	{ 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 }, { 37, 12 },
+	{ 37, 12 }, { 38, 12 }, { 38, 12 }, { 38, 12 }, { 38, 12 }, { 38, 12 },
+	{ 38, 12 }, { 38, 12 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 },
+	{ 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 },
+	{ 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 },
+	{ 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 }, { 38, 13 },
+	{ 38, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 },
+	{ 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 },
+	{ 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 },
+	{ 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 },
+	{ 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 }, { 39, 13 },
+	{ 39, 13 }, { 39, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 },
+	{ 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 },
+	{ 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 },
+	{ 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 }, { 40, 13 },
+	{ 40, 13 }, { 40, 14 }, { 40, 14 }, { 40, 14 }, { 40, 14 }, { 40, 14 },
+	{ 40, 14 }, { 40, 14 }, { 40, 14 }, { 40, 14 }, { 41, 14 }, { 41, 14 },
+	{ 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 },
+	{ 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 },
+	{ 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 },
+	{ 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 },
+	{ 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 }, { 41, 14 },
+	{ 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 },
+	{ 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 },
+	{ 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 }, { 42, 14 },
+	{ 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 },
+	{ 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 },
+	{ 42, 15 }, { 42, 15 }, { 42, 15 }, { 42, 15 }, { 43, 15 }, { 43, 15 },
+	{ 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 },
+	{ 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 },
+	{ 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 },
+	{ 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 },
+	{ 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 }, { 43, 15 },
+	{ 43, 15 }, { 43, 15 }, { 43, 15 }, { 44, 16 }, { 44, 16 }, { 44, 16 },
+	{ 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 },
+	{ 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 },
+	{ 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 },
+	{ 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 },
+	{ 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 },
+	{ 44, 16 }, { 44, 16 }, { 44, 16 }, { 44, 16 }, { 45, 16 }, { 45, 16 },
+	{ 45, 16 }, { 45, 16 }, { 45, 16 }, { 45, 16 }, { 45, 16 }, { 45, 16 },
+	{ 45, 16 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 },
+	{ 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 },
+	{ 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 },
+	{ 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 },
+	{ 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 }, { 45, 17 },
+	{ 45, 17 }, { 46, 17 }, { 46, 17 }, { 46, 17 }, { 46, 17 }, { 46, 17 },
+	{ 46, 17 }, { 46, 17 }, { 46, 17 }, { 46, 17 }, { 46, 17 }, { 46, 17 },
+	{ 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 },
+	{ 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 },
+	{ 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 },
+	{ 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 },
+	{ 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 }, { 46, 18 },
+	{ 47, 18 }, { 47, 18 }, { 47, 18 }, { 47, 18 }, { 47, 18 }, { 47, 18 },
+	{ 47, 18 }, { 47, 18 }, { 47, 18 }, { 47, 19 }, { 47, 19 }, { 47, 19 },
+	{ 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 },
+	{ 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 },
+	{ 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 },
+	{ 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 },
+	{ 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 },
+	{ 47, 19 }, { 47, 19 }, { 47, 19 }, { 47, 19 }, { 48, 20 }, { 48, 20 },
+	{ 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 },
+	{ 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 },
+	{ 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 },
+	{ 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 },
+	{ 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 20 },
+	{ 48, 20 }, { 48, 20 }, { 48, 20 }, { 48, 21 }, { 48, 21 }, { 48, 21 },
+	{ 48, 21 }, { 48, 21 }, { 48, 21 }, { 48, 21 }, { 48, 21 }, { 48, 21 },
+	{ 48, 21 }, { 48, 21 }, { 48, 21 }, { 48, 21 }, { 48, 21 }, { 48, 21 },
+	{ 48, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 },
+	{ 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 },
+	{ 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 }, { 49, 21 },
+	{ 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 },
+	{ 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 },
+	{ 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 },
+	{ 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 },
+	{ 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 22 },
+	{ 49, 22 }, { 49, 22 }, { 49, 22 }, { 49, 23 }, { 49, 23 }, { 49, 23 },
+	{ 49, 23 }, { 49, 23 }, { 49, 23 }, { 49, 23 }, { 49, 23 }, { 49, 23 },
+	{ 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 },
+	{ 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 },
+	{ 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 },
+	{ 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 23 }, { 50, 24 },
+	{ 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 },
+	{ 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 },
+	{ 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 },
+	{ 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 },
+	{ 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 }, { 50, 24 },
+	{ 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 },
+	{ 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 },
+	{ 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 },
+	{ 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 50, 25 }, { 51, 25 },
+	{ 51, 25 }, { 51, 25 }, { 51, 25 }, { 51, 25 }, { 51, 25 }, { 51, 25 },
+	{ 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 },
+	{ 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 },
+	{ 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 },
+	{ 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 },
+	{ 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 }, { 51, 26 },
+	{ 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 },
+	{ 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 },
+	{ 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 },
+	{ 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 },
+	{ 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 27 }, { 51, 28 },
+	{ 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 },
+	{ 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 },
+	{ 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 },
+	{ 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 },
+	{ 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 28 }, { 51, 29 }, { 51, 29 },
+	{ 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 },
+	{ 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 },
+	{ 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 },
+	{ 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 29 },
+	{ 51, 29 }, { 51, 29 }, { 51, 29 }, { 51, 30 }, { 51, 30 }, { 51, 30 },
+	{ 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 },
+	{ 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 },
+	{ 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 },
+	{ 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 }, { 51, 30 },
+	{ 51, 30 }, { 51, 30 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 },
+	{ 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 },
+	{ 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 },
+	{ 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 },
+	{ 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 }, { 51, 31 },
+	{ 52, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 },
+	{ 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 },
+	{ 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 },
+	{ 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 },
+	{ 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 32 }, { 51, 33 },
+	{ 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 },
+	{ 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 },
+	{ 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 },
+	{ 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 },
+	{ 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 33 }, { 51, 34 }, { 51, 34 },
+	{ 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 },
+	{ 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 },
+	{ 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 },
+	{ 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 34 },
+	{ 51, 34 }, { 51, 34 }, { 51, 34 }, { 51, 35 }, { 51, 35 }, { 51, 35 },
+	{ 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 },
+	{ 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 },
+	{ 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 },
+	{ 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 }, { 51, 35 },
+	{ 51, 35 }, { 51, 35 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 },
+	{ 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 },
+	{ 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 },
+	{ 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 },
+	{ 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 }, { 51, 36 },
+	{ 51, 36 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 },
+	{ 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 },
+	{ 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 },
+	{ 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 },
+	{ 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 }, { 51, 37 },
+	{ 51, 37 }, { 51, 38 }, { 51, 38 }, { 51, 38 }, { 51, 38 }, { 51, 38 },
+	{ 51, 38 }, { 51, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 },
+	{ 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 },
+	{ 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 },
+	{ 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 }, { 50, 38 },
+	{ 50, 38 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 },
+	{ 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 },
+	{ 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 },
+	{ 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 },
+	{ 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 }, { 50, 39 },
+	{ 50, 39 }, { 50, 39 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 },
+	{ 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 },
+	{ 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 },
+	{ 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 }, { 50, 40 },
+	{ 50, 40 }, { 49, 40 }, { 49, 40 }, { 49, 40 }, { 49, 40 }, { 49, 40 },
+	{ 49, 40 }, { 49, 40 }, { 49, 40 }, { 49, 40 }, { 49, 41 }, { 49, 41 },
+	{ 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 },
+	{ 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 },
+	{ 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 },
+	{ 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 },
+	{ 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 }, { 49, 41 },
+	{ 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 },
+	{ 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 },
+	{ 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 }, { 49, 42 },
+	{ 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 },
+	{ 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 },
+	{ 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 42 }, { 48, 43 }, { 48, 43 },
+	{ 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 },
+	{ 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 },
+	{ 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 },
+	{ 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 },
+	{ 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 }, { 48, 43 },
+	{ 48, 43 }, { 48, 43 }, { 48, 43 }, { 47, 44 }, { 47, 44 }, { 47, 44 },
+	{ 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 },
+	{ 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 },
+	{ 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 },
+	{ 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 },
+	{ 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 },
+	{ 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 44 }, { 47, 45 }, { 47, 45 },
+	{ 47, 45 }, { 47, 45 }, { 47, 45 }, { 47, 45 }, { 47, 45 }, { 47, 45 },
+	{ 47, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 },
+	{ 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 },
+	{ 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 },
+	{ 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 },
+	{ 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 }, { 46, 45 },
+	{ 46, 45 }, { 46, 46 }, { 46, 46 }, { 46, 46 }, { 46, 46 }, { 46, 46 },
+	{ 46, 46 }, { 46, 46 }, { 46, 46 }, { 46, 46 }, { 46, 46 }, { 46, 46 },
+	{ 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 },
+	{ 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 },
+	{ 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 },
+	{ 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 },
+	{ 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 }, { 45, 46 },
+	{ 45, 47 }, { 45, 47 }, { 45, 47 }, { 45, 47 }, { 45, 47 }, { 45, 47 },
+	{ 45, 47 }, { 45, 47 }, { 45, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 },
+	{ 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 },
+	{ 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 },
+	{ 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 },
+	{ 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 },
+	{ 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 },
+	{ 44, 47 }, { 44, 47 }, { 44, 47 }, { 44, 47 }, { 43, 48 }, { 43, 48 },
+	{ 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 },
+	{ 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 },
+	{ 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 },
+	{ 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 },
+	{ 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 }, { 43, 48 },
+	{ 43, 48 }, { 43, 48 }, { 43, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 },
+	{ 42, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 },
+	{ 42, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 }, { 42, 48 },
+	{ 42, 48 }, { 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 },
+	{ 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 },
+	{ 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 }, { 42, 49 },
+	{ 42, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 },
+	{ 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 },
+	{ 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 },
+	{ 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 },
+	{ 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 }, { 41, 49 },
+	{ 41, 49 }, { 41, 49 }, { 41, 49 }, { 40, 49 }, { 40, 49 }, { 40, 49 },
+	{ 40, 49 }, { 40, 49 }, { 40, 49 }, { 40, 49 }, { 40, 49 }, { 40, 49 },
+	{ 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 },
+	{ 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 },
+	{ 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 },
+	{ 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 40, 50 }, { 39, 50 },
+	{ 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 },
+	{ 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 },
+	{ 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 },
+	{ 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 },
+	{ 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 }, { 39, 50 },
+	{ 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 },
+	{ 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 },
+	{ 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 },
+	{ 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 50 }, { 38, 51 },
+	{ 38, 51 }, { 38, 51 }, { 38, 51 }, { 38, 51 }, { 38, 51 }, { 38, 51 },
+	{ 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 },
+	{ 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 },
+	{ 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 },
+	{ 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 },
+	{ 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 }, { 37, 51 },
+	{ 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 },
+	{ 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 },
+	{ 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 },
+	{ 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 },
+	{ 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 36, 51 }, { 35, 51 },
+	{ 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 },
+	{ 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 },
+	{ 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 },
+	{ 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 },
+	{ 35, 51 }, { 35, 51 }, { 35, 51 }, { 35, 51 }, { 34, 51 }, { 34, 51 },
+	{ 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 },
+	{ 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 },
+	{ 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 },
+	{ 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 }, { 34, 51 },
+	{ 34, 51 }, { 34, 51 }, { 34, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 },
+	{ 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 },
+	{ 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 },
+	{ 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 },
+	{ 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 }, { 33, 51 },
+	{ 33, 51 }, { 33, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 },
+	{ 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 },
+	{ 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 },
+	{ 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 },
+	{ 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 }, { 32, 51 },
+	{ 32, 52 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 },
+	{ 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 },
+	{ 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 },
+	{ 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 },
+	{ 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 31, 51 }, { 30, 51 },
+	{ 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 },
+	{ 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 },
+	{ 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 },
+	{ 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 },
+	{ 30, 51 }, { 30, 51 }, { 30, 51 }, { 30, 51 }, { 29, 51 }, { 29, 51 },
+	{ 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 },
+	{ 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 },
+	{ 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 },
+	{ 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 }, { 29, 51 },
+	{ 29, 51 }, { 29, 51 }, { 29, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 },
+	{ 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 },
+	{ 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 },
+	{ 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 },
+	{ 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 }, { 28, 51 },
+	{ 28, 51 }, { 28, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 },
+	{ 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 },
+	{ 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 },
+	{ 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 },
+	{ 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 }, { 27, 51 },
+	{ 27, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 },
+	{ 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 },
+	{ 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 },
+	{ 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 },
+	{ 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 }, { 26, 51 },
+	{ 26, 51 }, { 25, 51 }, { 25, 51 }, { 25, 51 }, { 25, 51 }, { 25, 51 },
+	{ 25, 51 }, { 25, 51 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 },
+	{ 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 },
+	{ 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 },
+	{ 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 }, { 25, 50 },
+	{ 25, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 },
+	{ 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 },
+	{ 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 },
+	{ 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 },
+	{ 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 }, { 24, 50 },
+	{ 24, 50 }, { 24, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 },
+	{ 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 },
+	{ 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 },
+	{ 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 }, { 23, 50 },
+	{ 23, 50 }, { 23, 49 }, { 23, 49 }, { 23, 49 }, { 23, 49 }, { 23, 49 },
+	{ 23, 49 }, { 23, 49 }, { 23, 49 }, { 23, 49 }, { 22, 49 }, { 22, 49 },
+	{ 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 },
+	{ 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 },
+	{ 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 },
+	{ 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 },
+	{ 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 }, { 22, 49 },
+	{ 22, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 },
+	{ 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 },
+	{ 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 }, { 21, 49 },
+	{ 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 },
+	{ 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 },
+	{ 21, 48 }, { 21, 48 }, { 21, 48 }, { 21, 48 }, { 20, 48 }, { 20, 48 },
+	{ 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 },
+	{ 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 },
+	{ 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 },
+	{ 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 },
+	{ 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 }, { 20, 48 },
+	{ 20, 48 }, { 20, 48 }, { 20, 48 }, { 19, 47 }, { 19, 47 }, { 19, 47 },
+	{ 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 },
+	{ 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 },
+	{ 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 },
+	{ 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 },
+	{ 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 },
+	{ 19, 47 }, { 19, 47 }, { 19, 47 }, { 19, 47 }, { 18, 47 }, { 18, 47 },
+	{ 18, 47 }, { 18, 47 }, { 18, 47 }, { 18, 47 }, { 18, 47 }, { 18, 47 },
+	{ 18, 47 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 },
+	{ 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 },
+	{ 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 },
+	{ 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 },
+	{ 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 }, { 18, 46 },
+	{ 18, 46 }, { 17, 46 }, { 17, 46 }, { 17, 46 }, { 17, 46 }, { 17, 46 },
+	{ 17, 46 }, { 17, 46 }, { 17, 46 }, { 17, 46 }, { 17, 46 }, { 17, 46 },
+	{ 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 },
+	{ 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 },
+	{ 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 },
+	{ 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 },
+	{ 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 }, { 17, 45 },
+	{ 16, 45 }, { 16, 45 }, { 16, 45 }, { 16, 45 }, { 16, 45 }, { 16, 45 },
+	{ 16, 45 }, { 16, 45 }, { 16, 45 }, { 16, 44 }, { 16, 44 }, { 16, 44 },
+	{ 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 },
+	{ 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 },
+	{ 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 },
+	{ 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 },
+	{ 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 },
+	{ 16, 44 }, { 16, 44 }, { 16, 44 }, { 16, 44 }, { 15, 43 }, { 15, 43 },
+	{ 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 },
+	{ 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 },
+	{ 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 },
+	{ 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 },
+	{ 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 43 },
+	{ 15, 43 }, { 15, 43 }, { 15, 43 }, { 15, 42 }, { 15, 42 }, { 15, 42 },
+	{ 15, 42 }, { 15, 42 }, { 15, 42 }, { 15, 42 }, { 15, 42 }, { 15, 42 },
+	{ 15, 42 }, { 15, 42 }, { 15, 42 }, { 15, 42 }, { 15, 42 }, { 15, 42 },
+	{ 15, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 },
+	{ 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 },
+	{ 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 }, { 14, 42 },
+	{ 14, 42 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 },
+	{ 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 },
+	{ 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 },
+	{ 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 },
+	{ 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 41 },
+	{ 14, 41 }, { 14, 41 }, { 14, 41 }, { 14, 40 }, { 14, 40 }, { 14, 40 },
+	{ 14, 40 }, { 14, 40 }, { 14, 40 }, { 14, 40 }, { 14, 40 }, { 14, 40 },
+	{ 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 },
+	{ 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 },
+	{ 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 },
+	{ 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 40 }, { 13, 39 },
+	{ 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 },
+	{ 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 },
+	{ 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 },
+	{ 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 },
+	{ 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 }, { 13, 39 },
+	{ 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 },
+	{ 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 },
+	{ 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 },
+	{ 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 13, 38 }, { 12, 38 },
+	{ 12, 38 }, { 12, 38 }, { 12, 38 }, { 12, 38 }, { 12, 38 }, { 12, 38 },
+	{ 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 },
+	{ 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 },
+	{ 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 },
+	{ 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 },
+	{ 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 }, { 12, 37 },
+	{ 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 },
+	{ 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 },
+	{ 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 },
+	{ 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 },
+	{ 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 36 }, { 12, 35 },
+	{ 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 },
+	{ 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 },
+	{ 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 },
+	{ 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 },
+	{ 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 35 }, { 12, 34 }, { 12, 34 },
+	{ 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 },
+	{ 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 },
+	{ 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 },
+	{ 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 34 },
+	{ 12, 34 }, { 12, 34 }, { 12, 34 }, { 12, 33 }, { 12, 33 }, { 12, 33 },
+	{ 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 },
+	{ 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 },
+	{ 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 },
+	{ 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 }, { 12, 33 },
+	{ 12, 33 }, { 12, 33 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 },
+	{ 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 },
+	{ 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 },
+	{ 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 },
+	{ 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 }, { 12, 32 },
+	{ 12, 32 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 },
+	{ 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 },
+	{ 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 },
+	{ 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 },
+	{ 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 31 }, { 12, 30 },
+	{ 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 },
+	{ 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 },
+	{ 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 },
+	{ 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 },
+	{ 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 30 }, { 12, 29 }, { 12, 29 },
+	{ 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 },
+	{ 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 },
+	{ 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 },
+	{ 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 29 },
+	{ 12, 29 }, { 12, 29 }, { 12, 29 }, { 12, 28 }, { 12, 28 }, { 12, 28 },
+	{ 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 },
+	{ 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 },
+	{ 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 },
+	{ 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 }, { 12, 28 },
+	{ 12, 28 }, { 12, 28 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 },
+	{ 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 },
+	{ 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 },
+	{ 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 },
+	{ 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 }, { 12, 27 },
+	{ 12, 27 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 },
+	{ 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 },
+	{ 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 },
+	{ 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 },
+	{ 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 }, { 12, 26 },
+	{ 12, 26 }, { 12, 25 }, { 12, 25 }, { 12, 25 }, { 12, 25 }, { 12, 25 },
+	{ 12, 25 }, { 12, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 },
+	{ 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 },
+	{ 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 },
+	{ 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 }, { 13, 25 },
+	{ 13, 25 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 },
+	{ 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 },
+	{ 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 },
+	{ 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 },
+	{ 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 }, { 13, 24 },
+	{ 13, 24 }, { 13, 24 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 },
+	{ 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 },
+	{ 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 },
+	{ 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 }, { 13, 23 },
+	{ 13, 23 }, { 14, 23 }, { 14, 23 }, { 14, 23 }, { 14, 23 }, { 14, 23 },
+	{ 14, 23 }, { 14, 23 }, { 14, 23 }, { 14, 23 }, { 14, 22 }, { 14, 22 },
+	{ 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 },
+	{ 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 },
+	{ 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 },
+	{ 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 },
+	{ 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 }, { 14, 22 },
+	{ 14, 22 }, { 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 },
+	{ 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 },
+	{ 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 }, { 14, 21 },
+	{ 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 },
+	{ 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 },
+	{ 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 21 }, { 15, 20 }, { 15, 20 },
+	{ 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 },
+	{ 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 },
+	{ 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 },
+	{ 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 },
+	{ 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 }, { 15, 20 },
+	{ 15, 20 }, { 15, 20 }, { 15, 20 }, { 16, 19 }, { 16, 19 }, { 16, 19 },
+	{ 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 },
+	{ 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 },
+	{ 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 },
+	{ 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 },
+	{ 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 },
+	{ 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 19 }, { 16, 18 }, { 16, 18 },
+	{ 16, 18 }, { 16, 18 }, { 16, 18 }, { 16, 18 }, { 16, 18 }, { 16, 18 },
+	{ 16, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 },
+	{ 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 },
+	{ 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 },
+	{ 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 },
+	{ 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 }, { 17, 18 },
+	{ 17, 18 }, { 17, 17 }, { 17, 17 }, { 17, 17 }, { 17, 17 }, { 17, 17 },
+	{ 17, 17 }, { 17, 17 }, { 17, 17 }, { 17, 17 }, { 17, 17 }, { 17, 17 },
+	{ 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 },
+	{ 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 },
+	{ 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 },
+	{ 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 },
+	{ 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 }, { 18, 17 },
+	{ 18, 16 }, { 18, 16 }, { 18, 16 }, { 18, 16 }, { 18, 16 }, { 18, 16 },
+	{ 18, 16 }, { 18, 16 }, { 18, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 },
+	{ 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 },
+	{ 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 },
+	{ 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 },
+	{ 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 },
+	{ 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 },
+	{ 19, 16 }, { 19, 16 }, { 19, 16 }, { 19, 16 }, { 20, 15 }, { 20, 15 },
+	{ 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 },
+	{ 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 },
+	{ 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 },
+	{ 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 },
+	{ 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 }, { 20, 15 },
+	{ 20, 15 }, { 20, 15 }, { 20, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 },
+	{ 21, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 },
+	{ 21, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 }, { 21, 15 },
+	{ 21, 15 }, { 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 },
+	{ 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 },
+	{ 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 }, { 21, 14 },
+	{ 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 },
+	{ 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 },
+	{ 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 },
+	{ 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 },
+	{ 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 }, { 22, 14 },
+	{ 22, 14 }, { 22, 14 }, { 22, 14 }, { 23, 14 }, { 23, 14 }, { 23, 14 },
+	{ 23, 14 }, { 23, 14 }, { 23, 14 }, { 23, 14 }, { 23, 14 }, { 23, 14 },
+	{ 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 },
+	{ 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 },
+	{ 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 },
+	{ 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 23, 13 }, { 24, 13 },
+	{ 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 },
+	{ 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 },
+	{ 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 },
+	{ 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 },
+	{ 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 }, { 24, 13 },
+	{ 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 },
+	{ 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 },
+	{ 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 },
+	{ 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 13 }, { 25, 12 },
+	{ 25, 12 }, { 25, 12 }, { 25, 12 }, { 25, 12 }, { 25, 12 }, { 25, 12 },
+	{ 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 },
+	{ 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 },
+	{ 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 },
+	{ 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 },
+	{ 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 }, { 26, 12 },
+	{ 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 },
+	{ 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 },
+	{ 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 },
+	{ 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 },
+	{ 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 27, 12 }, { 28, 12 },
+	{ 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 },
+	{ 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 },
+	{ 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 },
+	{ 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 },
+	{ 28, 12 }, { 28, 12 }, { 28, 12 }, { 28, 12 }, { 29, 12 }, { 29, 12 },
+	{ 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 },
+	{ 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 },
+	{ 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 },
+	{ 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 }, { 29, 12 },
+	{ 29, 12 }, { 29, 12 }, { 29, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 },
+	{ 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 },
+	{ 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 },
+	{ 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 },
+	{ 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 }, { 30, 12 },
+	{ 30, 12 }, { 30, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 },
+	{ 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 },
+	{ 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 },
+	{ 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 },
+	{ 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 }, { 31, 12 },
+};
+
+/* 15 long, 1440 steps a turn */
+const struct dial_point dial_hour[1440] = {
+	{ 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 },
+	{ 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 },
+	{ 32, 17 }, { 32, 17 }, { 32, 17 }, { 32, 17 }, { 33, 17 }, { 33, 17 },
+	{ 33, 17 }, { 33, 17 }, { 33, 17 }, { 33, 17 }, { 33, 17 }, { 33, 17 },
+	{ 33, 17 }, { 33, 17 }, { 33, 17 }, { 33, 17 }, { 33, 17 }, { 33, 17 },
+	{ 33, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 },
+	{ 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 },
+	{ 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 }, { 34, 17 }, { 35, 17 },
+	{ 35, 17 }, { 35, 17 }, { 35, 17 }, { 35, 17 }, { 35, 17 }, { 35, 17 },
+	{ 35, 17 }, { 35, 17 }, { 35, 17 }, { 35, 17 }, { 35, 17 }, { 35, 17 },
+	{ 35, 17 }, { 35, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 },
+	{ 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 },
+	{ 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 }, { 36, 17 },
+	{ 37, 17 }, { 37, 17 }, { 37, 17 }, { 37, 17 }, { 37, 17 }, { 37, 17 },
+	{ 37, 17 }, { 37, 18 }, { 37, 18 }, { 37, 18 }, { 37, 18 }, { 37, 18 },
+	{ 37, 18 }, { 37, 18 }, { 37, 18 }, { 37, 18 }, { 37, 18 }, { 38, 18 },
+	{ 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 },
+	{ 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 },
+	{ 38, 18 }, { 38, 18 }, { 38, 18 }, { 38, 18 }, { 39, 18 }, { 39, 18 },
+	{ 39, 18 }, { 39, 18 }, { 39, 18 }, { 39, 18 }, { 39, 18 }, { 39, 18 },
+	{ 39, 19 }, { 39, 19 }, { 39, 19 }, { 39, 19 }, { 39, 19 }, { 39, 19 },
+	{ 39, 19 }, { 39, 19 }, { 39, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 },
+	{ 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 },
+	{ 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 },
+	{ 40, 19 }, { 40, 19 }, { 40, 19 }, { 40, 19 }, { 41, 20 }, { 41, 20 },
+	{ 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 },
+	{ 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 },
+	{ 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 }, { 41, 20 },
+	{ 42, 20 }, { 42, 20 }, { 42, 20 }, { 42, 20 }, { 42, 21 }, { 42, 21 },
+	{ 42, 21 }, { 42, 21 }, { 42, 21 }, { 42, 21 }, { 42, 21 }, { 42, 21 },
+	{ 42, 21 }, { 42, 21 }, { 42, 21 }, { 42, 21 }, { 42, 21 }, { 42, 21 },
+	{ 42, 21 }, { 42, 21 }, { 42, 21 }, { 43, 21 }, { 43, 21 }, { 43, 21 },
+	{ 43, 21 }, { 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 },
+	{ 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 },
+	{ 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 }, { 43, 22 },
+	{ 43, 22 }, { 43, 22 }, { 43, 22 }, { 44, 23 }, { 44, 23 }, { 44, 23 },
+	{ 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 },
+	{ 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 },
+	{ 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 23 }, { 44, 24 }, { 44, 24 },
+	{ 44, 24 }, { 44, 24 }, { 44, 24 }, { 44, 24 }, { 44, 24 }, { 44, 24 },
+	{ 44, 24 }, { 45, 24 }, { 45, 24 }, { 45, 24 }, { 45, 24 }, { 45, 24 },
+	{ 45, 24 }, { 45, 24 }, { 45, 24 }, { 45, 25 }, { 45, 25 }, { 45, 25 },
+	{ 45, 25 }, { 45, 25 }, { 45, 25 }, { 45, 25 }, { 45, 25 }, { 45, 25 },
+	{ 45, 25 }, { 45, 25 }, { 45, 25 }, { 45, 25 }, { 45, 25 }, { 45, 25 },
+	{ 45, 25 }, { 45, 25 }, { 45, 26 }, { 45, 26 }, { 45, 26 }, { 45, 26 },
+	{ 45, 26 }, { 45, 26 }, { 45, 26 }, { 45, 26 }, { 45, 26 }, { 45, 26 },
+	{ 46, 26 }, { 46, 26 }, { 46, 26 }, { 46, 26 }, { 46, 26 }, { 46, 26 },
+	{ 46, 26 }, { 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 },
+	{ 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 },
+	{ 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 27 }, { 46, 28 },
+	{ 46, 28 }, { 46, 28 }, { 46, 28 }, { 46, 28 }, { 46, 28 }, { 46, 28 },
+	{ 46, 28 }, { 46, 28 }, { 46, 28 }, { 46, 28 }, { 46, 28 }, { 46, 28 },
+	{ 46, 28 }, { 46, 28 }, { 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 },
+	{ 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 },
+	{ 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 }, { 46, 29 },
+	{ 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 30 },
+	{ 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 30 },
+	{ 46, 30 }, { 46, 30 }, { 46, 30 }, { 46, 31 }, { 46, 31 }, { 46, 31 },
+	{ 46, 31 }, { 46, 31 }, { 46, 31 }, { 46, 31 }, { 46, 31 }, { 46, 31 },
+	{ 46, 31 }, { 46, 31 }, { 46, 31 }, { 46, 31 }, { 46, 31 }, { 46, 31 },
+	{ 47, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 },
+	{ 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 },
+	{ 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 32 }, { 46, 33 }, { 46, 33 },
+	{ 46, 33 }, { 46, 33 }, { 46, 33 }, { 46, 33 }, { 46, 33 }, { 46, 33 },
+	{ 46, 33 }, { 46, 33 }, { 46, 33 }, { 46, 33 }, { 46, 33 }, { 46, 33 },
+	{ 46, 33 }, { 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 },
+	{ 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 },
+	{ 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 34 }, { 46, 35 },
+	{ 46, 35 }, { 46, 35 }, { 46, 35 }, { 46, 35 }, { 46, 35 }, { 46, 35 },
+	{ 46, 35 }, { 46, 35 }, { 46, 35 }, { 46, 35 }, { 46, 35 }, { 46, 35 },
+	{ 46, 35 }, { 46, 35 }, { 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 },
+	{ 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 },
+	{ 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 }, { 46, 36 },
+	{ 46, 37 }, { 46, 37 }, { 46, 37 }, { 46, 37 }, { 46, 37 }, { 46, 37 },
+	{ 46, 37 }, { 45, 37 }, { 45, 37 }, { 45, 37 }, { 45, 37 }, { 45, 37 },
+	{ 45, 37 }, { 45, 37 }, { 45, 37 }, { 45, 37 }, { 45, 37 }, { 45, 38 },
+	{ 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 },
+	{ 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 },
+	{ 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 38 }, { 45, 39 }, { 45, 39 },
+	{ 45, 39 }, { 45, 39 }, { 45, 39 }, { 45, 39 }, { 45, 39 }, { 45, 39 },
+	{ 44, 39 }, { 44, 39 }, { 44, 39 }, { 44, 39 }, { 44, 39 }, { 44, 39 },
+	{ 44, 39 }, { 44, 39 }, { 44, 39 }, { 44, 40 }, { 44, 40 }, { 44, 40 },
+	{ 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 },
+	{ 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 },
+	{ 44, 40 }, { 44, 40 }, { 44, 40 }, { 44, 40 }, { 43, 41 }, { 43, 41 },
+	{ 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 },
+	{ 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 },
+	{ 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 }, { 43, 41 },
+	{ 43, 42 }, { 43, 42 }, { 43, 42 }, { 43, 42 }, { 42, 42 }, { 42, 42 },
+	{ 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 42 },
+	{ 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 42 },
+	{ 42, 42 }, { 42, 42 }, { 42, 42 }, { 42, 43 }, { 42, 43 }, { 42, 43 },
+	{ 42, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 },
+	{ 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 },
+	{ 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 }, { 41, 43 },
+	{ 41, 43 }, { 41, 43 }, { 41, 43 }, { 40, 44 }, { 40, 44 }, { 40, 44 },
+	{ 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 },
+	{ 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 },
+	{ 40, 44 }, { 40, 44 }, { 40, 44 }, { 40, 44 }, { 39, 44 }, { 39, 44 },
+	{ 39, 44 }, { 39, 44 }, { 39, 44 }, { 39, 44 }, { 39, 44 }, { 39, 44 },
+	{ 39, 44 }, { 39, 45 }, { 39, 45 }, { 39, 45 }, { 39, 45 }, { 39, 45 },
+	{ 39, 45 }, { 39, 45 }, { 39, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 },
+	{ 38, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 },
+	{ 38, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 }, { 38, 45 },
+	{ 38, 45 }, { 38, 45 }, { 37, 45 }, { 37, 45 }, { 37, 45 }, { 37, 45 },
+	{ 37, 45 }, { 37, 45 }, { 37, 45 }, { 37, 45 }, { 37, 45 }, { 37, 45 },
+	{ 37, 46 }, { 37, 46 }, { 37, 46 }, { 37, 46 }, { 37, 46 }, { 37, 46 },
+	{ 37, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 },
+	{ 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 },
+	{ 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 }, { 36, 46 }, { 35, 46 },
+	{ 35, 46 }, { 35, 46 }, { 35, 46 }, { 35, 46 }, { 35, 46 }, { 35, 46 },
+	{ 35, 46 }, { 35, 46 }, { 35, 46 }, { 35, 46 }, { 35, 46 }, { 35, 46 },
+	{ 35, 46 }, { 35, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 },
+	{ 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 },
+	{ 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 }, { 34, 46 },
+	{ 33, 46 }, { 33, 46 }, { 33, 46 }, { 33, 46 }, { 33, 46 }, { 33, 46 },
+	{ 33, 46 }, { 33, 46 }, { 33, 46 }, { 33, 46 }, { 33, 46 }, { 33, 46 },
+	{ 33, 46 }, { 33, 46 }, { 33, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 },
+	{ 32, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 },
+	{ 32, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 }, { 32, 46 },
+	{ 32, 47 }, { 31, 46 }, { 31, 46 }, { 31, 46 }, { 31, 46 }, { 31, 46 },
+	{ 31, 46 }, { 31, 46 }, { 31, 46 }, { 31, 46 }, { 31, 46 }, { 31, 46 },
+	{ 31, 46 }, { 31, 46 }, { 31, 46 }, { 31, 46 }, { 30, 46 }, { 30, 46 },
+	{ 30, 46 }, { 30, 46 }, { 30, 46 }, { 30, 46 }, { 30, 46 }, { 30, 46 },
+	{ 30, 46 }, { 30, 46 }, { 30, 46 }, { 30, 46 }, { 30, 46 }, { 30, 46 },
+	{ 30, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 },
+	{ 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 },
+	{ 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 }, { 29, 46 }, { 28, 46 },
+	{ 28, 46 }, { 28, 46 }, { 28, 46 }, { 28, 46 }, { 28, 46 }, { 28, 46 },
+	{ 28, 46 }, { 28, 46 }, { 28, 46 }, { 28, 46 }, { 28, 46 }, { 28, 46 },
+	{ 28, 46 }, { 28, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 },
+	{ 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 },
+	{ 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 }, { 27, 46 },
+	{ 26, 46 }, { 26, 46 }, { 26, 46 }, { 26, 46 }, { 26, 46 }, { 26, 46 },
+	{ 26, 46 }, { 26, 45 }, { 26, 45 }, { 26, 45 }, { 26, 45 }, { 26, 45 },
+	{ 26, 45 }, { 26, 45 }, { 26, 45 }, { 26, 45 }, { 26, 45 }, { 25, 45 },
+	{ 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 },
+	{ 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 },
+	{ 25, 45 }, { 25, 45 }, { 25, 45 }, { 25, 45 }, { 24, 45 }, { 24, 45 },
+	{ 24, 45 }, { 24, 45 }, { 24, 45 }, { 24, 45 }, { 24, 45 }, { 24, 45 },
+	{ 24, 44 }, { 24, 44 }, { 24, 44 }, { 24, 44 }, { 24, 44 }, { 24, 44 },
+	{ 24, 44 }, { 24, 44 }, { 24, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 },
+	{ 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 },
+	{ 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 },
+	{ 23, 44 }, { 23, 44 }, { 23, 44 }, { 23, 44 }, { 22, 43 }, { 22, 43 },
+	{ 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 },
+	{ 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 },
+	{ 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 }, { 22, 43 },
+	{ 21, 43 }, { 21, 43 }, { 21, 43 }, { 21, 43 }, { 21, 42 }, { 21, 42 },
+	{ 21, 42 }, { 21, 42 }, { 21, 42 }, { 21, 42 }, { 21, 42 }, { 21, 42 },
+	{ 21, 42 }, { 21, 42 }, { 21, 42 }, { 21, 42 }, { 21, 42 }, { 21, 42 },
+	{ 21, 42 }, { 21, 42 }, { 21, 42 }, { 20, 42 }, { 20, 42 }, { 20, 42 },
+	{ 20, 42 }, { 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 },
+	{ 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 },
+	{ 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 }, { 20, 41 },
+	{ 20, 41 }, { 20, 41 }, { 20, 41 }, { 19, 40 }, { 19, 40 }, { 19, 40 },
+	{ 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 },
+	{ 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 },
+	{ 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 40 }, { 19, 39 }, { 19, 39 },
+	{ 19, 39 }, { 19, 39 }, { 19, 39 }, { 19, 39 }, { 19, 39 }, { 19, 39 },
+	{ 19, 39 }, { 18, 39 }, { 18, 39 }, { 18, 39 }, { 18, 39 }, { 18, 39 },
+	{ 18, 39 }, { 18, 39 }, { 18, 39 }, { 18, 38 }, { 18, 38 }, { 18, 38 },
+	{ 18, 38 }, { 18, 38 }, { 18, 38 }, { 18, 38 }, { 18, 38 }, { 18, 38 },
+	{ 18, 38 }, { 18, 38 }, { 18, 38 }, { 18, 38 }, { 18, 38 }, { 18, 38 },
+	{ 18, 38 }, { 18, 38 }, { 18, 37 }, { 18, 37 }, { 18, 37 }, { 18, 37 },
+	{ 18, 37 }, { 18, 37 }, { 18, 37 }, { 18, 37 }, { 18, 37 }, { 18, 37 },
+	{ 17, 37 }, { 17, 37 }, { 17, 37 }, { 17, 37 }, { 17, 37 }, { 17, 37 },
+	{ 17, 37 }, { 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 },
+	{ 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 },
+	{ 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 36 }, { 17, 35 },
+	{ 17, 35 }, { 17, 35 }, { 17, 35 }, { 17, 35 }, { 17, 35 }, { 17, 35 },
+	{ 17, 35 }, { 17, 35 }, { 17, 35 }, { 17, 35 }, { 17, 35 }, { 17, 35 },
+	{ 17, 35 }, { 17, 35 }, { 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 },
+	{ 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 },
+	{ 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 }, { 17, 34 },
+	{ 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 33 },
+	{ 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 33 },
+	{ 17, 33 }, { 17, 33 }, { 17, 33 }, { 17, 32 }, { 17, 32 }, { 17, 32 },
+	{ 17, 32 }, { 17, 32 }, { 17, 32 }, { 17, 32 }, { 17, 32 }, { 17, 32 },
+	{ 17, 32 }, { 17, 32 }, { 17, 32 }, { 17, 32 }, { 17, 32 }, { 17, 32 },
+	{ 17, 32 }, { 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 31 },
+	{ 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 31 },
+	{ 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 31 }, { 17, 30 }, { 17, 30 },
+	{ 17, 30 }, { 17, 30 }, { 17, 30 }, { 17, 30 }, { 17, 30 }, { 17, 30 },
+	{ 17, 30 }, { 17, 30 }, { 17, 30 }, { 17, 30 }, { 17, 30 }, { 17, 30 },
+	{ 17, 30 }, { 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 },
+	{ 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 },
+	{ 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 29 }, { 17, 28 },
+	{ 17, 28 }, { 17, 28 }, { 17, 28 }, { 17, 28 }, { 17, 28 }, { 17, 28 },
+	{ 17, 28 }, { 17, 28 }, { 17, 28 }, { 17, 28 }, { 17, 28 }, { 17, 28 },
+	{ 17, 28 }, { 17, 28 }, { 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 },
+	{ 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 },
+	{ 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 }, { 17, 27 },
+	{ 17, 26 }, { 17, 26 }, { 17, 26 }, { 17, 26 }, { 17, 26 }, { 17, 26 },
+	{ 17, 26 }, { 18, 26 }, { 18, 26 }, { 18, 26 }, { 18, 26 }, { 18, 26 },
+	{ 18, 26 }, { 18, 26 }, { 18, 26 }, { 18, 26 }, { 18, 26 }, { 18, 25 },
+	{ 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 },
+	{ 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 },
+	{ 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 25 }, { 18, 24 }, { 18, 24 },
+	{ 18, 24 }, { 18, 24 }, { 18, 24 }, { 18, 24 }, { 18, 24 }, { 18, 24 },
+	{ 19, 24 }, { 19, 24 }, { 19, 24 }, { 19, 24 }, { 19, 24 }, { 19, 24 },
+	{ 19, 24 }, { 19, 24 }, { 19, 24 }, { 19, 23 }, { 19, 23 }, { 19, 23 },
+	{ 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 },
+	{ 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 },
+	{ 19, 23 }, { 19, 23 }, { 19, 23 }, { 19, 23 }, { 20, 22 }, { 20, 22 },
+	{ 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 },
+	{ 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 },
+	{ 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 }, { 20, 22 },
+	{ 20, 21 }, { 20, 21 }, { 20, 21 }, { 20, 21 }, { 21, 21 }, { 21, 21 },
+	{ 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 21 },
+	{ 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 21 },
+	{ 21, 21 }, { 21, 21 }, { 21, 21 }, { 21, 20 }, { 21, 20 }, { 21, 20 },
+	{ 21, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 },
+	{ 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 },
+	{ 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 }, { 22, 20 },
+	{ 22, 20 }, { 22, 20 }, { 22, 20 }, { 23, 19 }, { 23, 19 }, { 23, 19 },
+	{ 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 },
+	{ 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 },
+	{ 23, 19 }, { 23, 19 }, { 23, 19 }, { 23, 19 }, { 24, 19 }, { 24, 19 },
+	{ 24, 19 }, { 24, 19 }, { 24, 19 }, { 24, 19 }, { 24, 19 }, { 24, 19 },
+	{ 24, 19 }, { 24, 18 }, { 24, 18 }, { 24, 18 }, { 24, 18 }, { 24, 18 },
+	{ 24, 18 }, { 24, 18 }, { 24, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 },
+	{ 25, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 },
+	{ 25, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 }, { 25, 18 },
+	{ 25, 18 }, { 25, 18 }, { 26, 18 }, { 26, 18 }, { 26, 18 }, { 26, 18 },
+	{ 26, 18 }, { 26, 18 }, { 26, 18 }, { 26, 18 }, { 26, 18 }, { 26, 18 },
+	{ 26, 17 }, { 26, 17 }, { 26, 17 }, { 26, 17 }, { 26, 17 }, { 26, 17 },
+	{ 26, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 },
+	{ 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 },
+	{ 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 }, { 27, 17 }, { 28, 17 },
+	{ 28, 17 }, { 28, 17 }, { 28, 17 }, { 28, 17 }, { 28, 17 }, { 28, 17 },
+	{ 28, 17 }, { 28, 17 }, { 28, 17 }, { 28, 17 }, { 28, 17 }, { 28, 17 },
+	{ 28, 17 }, { 28, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 },
+	{ 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 },
+	{ 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 }, { 29, 17 },
+	{ 30, 17 }, { 30, 17 }, { 30, 17 }, { 30, 17 }, { 30, 17 }, { 30, 17 },
+	{ 30, 17 }, { 30, 17 }, { 30, 17 }, { 30, 17 }, { 30, 17 }, { 30, 17 },
+	{ 30, 17 }, { 30, 17 }, { 30, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 },
+	{ 31, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 },
+	{ 31, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 }, { 31, 17 },
+};
+
+/* tick marks, out at 30 and in at 25 */
+const struct dial_point dial_tick[DIAL_TICKS][2] = {
+	{ { 32, 62 }, { 32, 57 } }, { { 35, 62 }, { 35, 57 } }, { { 38, 61 }, { 37, 56 } },
+	{ { 41, 61 }, { 40, 56 } }, { { 44, 59 }, { 42, 55 } }, { { 47, 58 }, { 45, 54 } },
+	{ { 50, 56 }, { 47, 52 } }, { { 52, 54 }, { 49, 51 } }, { { 54, 52 }, { 51, 49 } },
+	{ { 56, 50 }, { 52, 47 } }, { { 58, 47 }, { 54, 45 } }, { { 59, 44 }, { 55, 42 } },
+	{ { 61, 41 }, { 56, 40 } }, { { 61, 38 }, { 56, 37 } }, { { 62, 35 }, { 57, 35 } },
+	{ { 62, 32 }, { 57, 32 } }, { { 62, 29 }, { 57, 29 } }, { { 61, 26 }, { 56, 27 } },
+	{ { 61, 23 }, { 56, 24 } }, { { 59, 20 }, { 55, 22 } }, { { 58, 17 }, { 54, 20 } },
+	{ { 56, 14 }, { 52, 17 } }, { { 54, 12 }, { 51, 15 } }, { { 52, 10 }, { 49, 13 } },
+	{ { 50,  8 }, { 47, 12 } }, { { 47,  6 }, { 45, 10 } }, { { 44,  5 }, { 42,  9 } },
+	{ { 41,  3 }, { 40,  8 } }, { { 38,  3 }, { 37,  8 } }, { { 35,  2 }, { 35,  7 } },
+	{ { 32,  2 }, { 32,  7 } }, { { 29,  2 }, { 29,  7 } }, { { 26,  3 }, { 27,  8 } },
+	{ { 23,  3 }, { 24,  8 } }, { { 20,  5 }, { 22,  9 } }, { { 17,  6 }, { 19, 10 } },
+	{ { 14,  8 }, { 17, 12 } }, { { 12, 10 }, { 15, 13 } }, { { 10, 12 }, { 13, 15 } },
+	{ {  8, 14 }, { 12, 17 } }, { {  6, 17 }, { 10, 19 } }, { {  5, 20 }, {  9, 22 } },
+	{ {  3, 23 }, {  8, 24 } }, { {  3, 26 }, {  8, 27 } }, { {  2, 29 }, {  7, 29 } },
+	{ {  2, 32 }, {  7, 32 } }, { {  2, 35 }, {  7, 35 } }, { {  3, 38 }, {  8, 37 } },
+	{ {  3, 41 }, {  8, 40 } }, { {  5, 44 }, {  9, 42 } }, { {  6, 47 }, { 10, 45 } },
+	{ {  8, 50 }, { 12, 47 } }, { { 10, 52 }, { 13, 49 } }, { { 12, 54 }, { 15, 51 } },
+	{ { 14, 56 }, { 17, 52 } }, { { 17, 58 }, { 19, 54 } }, { { 20, 59 }, { 22, 55 } },
+	{ { 23, 61 }, { 24, 56 } }, { { 26, 61 }, { 27, 56 } }, { { 29, 62 }, { 29, 57 } },
+};
+
+/* the rim, 31 out every 5 degrees */
+const struct dial_point dial_rim[DIAL_RIM + 1] = {
+	{ 32, 63 }, { 35, 63 }, { 37, 63 }, { 40, 62 }, { 43, 61 }, { 45, 60 },
+	{ 48, 59 }, { 50, 57 }, { 52, 56 }, { 54, 54 }, { 56, 52 }, { 57, 50 },
+	{ 59, 48 }, { 60, 45 }, { 61, 43 }, { 62, 40 }, { 63, 37 }, { 63, 35 },
+	{ 63, 32 }, { 63, 29 }, { 63, 27 }, { 62, 24 }, { 61, 21 }, { 60, 19 },
+	{ 59, 17 }, { 57, 14 }, { 56, 12 }, { 54, 10 }, { 52,  8 }, { 50,  7 },
+	{ 48,  5 }, { 45,  4 }, { 43,  3 }, { 40,  2 }, { 37,  1 }, { 35,  1 },
+	{ 32,  1 }, { 29,  1 }, { 27,  1 }, { 24,  2 }, { 21,  3 }, { 19,  4 },
+	{ 16,  5 }, { 14,  7 }, { 12,  8 }, { 10, 10 }, {  8, 12 }, {  7, 14 },
+	{  5, 16 }, {  4, 19 }, {  3, 21 }, {  2, 24 }, {  1, 27 }, {  1, 29 },
+	{  1, 32 }, {  1, 35 }, {  1, 37 }, {  2, 40 }, {  3, 43 }, {  4, 45 },
+	{  5, 48 }, {  7, 50 }, {  8, 52 }, { 10, 54 }, { 12, 56 }, { 14, 57 },
+	{ 16, 59 }, { 19, 60 }, { 21, 61 }, { 24, 62 }, { 27, 63 }, { 29, 63 },
+	{ 32, 63 },
+};
@@ -0,0 +1,40 @@
+/*
+ * dial.h
+ *
+ * Where the hands, tick marks and rim of the 64 x 64 clock face go, as
+ * whole pixels, for each position they can be in. The tables are in
+ * dial.c, which tools/dial_tables.py writes (run it again rather than
+ * editing it), so drawing a clock needs no trig at all.
+ *
+ * A hand that moves 'n' steps a turn, 'len' pixels from DIAL_CX,
+ * DIAL_CY, ends at the table entry for its step; step 0 is 12 o'clock
+ * and they go round clockwise. The tick marks and the rim are as the
+ * face has always drawn them (the y axis the other way up, which is
+ * the same for them).
+ */
+#ifndef __DIAL_H
+#define __DIAL_H
+
+#define DIAL_CX			32
+#define DIAL_CY			32
+
+#define DIAL_MS_STEPS	1000	/* 10 long, a turn a second */
+#define DIAL_SEC_STEPS	3600	/* 25 long, a turn a minute */
+#define DIAL_MIN_STEPS	3600	/* 20 long, a turn an hour */
+#define DIAL_HOUR_STEPS	1440	/* 15 long, a turn a day (two for 12 hours) */
+#define DIAL_TICKS		60		/* 30 out, the long ones from 25 */
+#define DIAL_RIM_INC	5		/* degrees, the rim is a line each */
+#define DIAL_RIM		(360 / DIAL_RIM_INC)
+
+struct dial_point {
+	uint8_t		x, y;
+};
+
+extern const struct dial_point dial_ms[DIAL_MS_STEPS];
+extern const struct dial_point dial_sec[DIAL_SEC_STEPS];
+extern const struct dial_point dial_min[DIAL_MIN_STEPS];
+extern const struct dial_point dial_hour[DIAL_HOUR_STEPS];
+extern const struct dial_point dial_tick[DIAL_TICKS][2];	/* out, in */
+extern const struct dial_point dial_rim[DIAL_RIM + 1];		/* back to the start */
+
+#endif /* generic header protector */
@@ -0,0 +1,247 @@
+/*
+ * fmath.c -- quick single precision and fixed point math
+ *
+ * sin() and cos() on doubles go through soft float on the M4F, which
+ * only has a single precision FPU, and drawing doesn't need anything
+ * like double precision anyway. These take floats, reduce the angle to
+ * within an eighth of a turn of an axis and use short polynomials
+ * (the Cephes single precision ones), which the FPU does in a few
+ * dozen cycles.
+ *
+ * The fixed point versions don't touch the FPU: sine comes from a
+ * table of a turn in 256 steps with straight lines between, atan2
+ * from 32 steps of an eighth of a turn, and the square root is done a
+ * bit at a time. The tables are filled in the first time they're
+ * used, from the float versions.
+ *
+ * The error bounds are in fmath.h, tools/fmath_check.py checks them
+ * against libm on the host.
+ */
+
+#include <stdint.h>
+#include "../util/fmath.h"
+
+#define PIO2_HI		1.5703125f				/* pi / 2 in two parts, so */
+#define PIO2_LO		4.83826794897e-4f		/* x - n * pi / 2 stays exact */
+#define TWO_OVER_PI	0.636619772368f
+#define PIO4		0.785398163397f
+#define TAN_PI_8	0.414213562373f
+#define TAN_3PI_8	2.41421356237f
+
+#define SIN_STEPS	256
+#define ATAN_STEPS	32
+/*
+ * A straight line between two table entries sags below the curve by
+ * up to (2 pi / SIN_STEPS)^2 / 8 of the sine in the middle, so the
+ * entries are scaled up by half of that to split the error.
+ */
+#define SIN_LIFT	(1 + (2 * FM_PI / SIN_STEPS) * (2 * FM_PI / SIN_STEPS) / 16)
+
+static int16_t sin_tab[SIN_STEPS + 1];
+static uint16_t atan_tab[ATAN_STEPS + 1];	/* binary angle of atan(i / 32) */
+
+/* sin(r) and cos(r) for |r| <= pi / 4 */
+static float
+sin_poly(float r)
+{
+	float	z = r * r;
+
+	return r + r * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z -
+						1.6666654611e-1f);
+}
+
+static float
+cos_poly(float r)
+{
+	float	z = r * r;
+
+	return 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z -
+						1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+}
+
+/* sin(x + 'quarter' quarter turns) */
+static float
+sin_quarter(float x, int quarter)
+{
+	float	r;
+	int		n;
+
+	n = (int) ((x * TWO_OVER_PI) + ((x < 0) ? -0.5f : 0.5f));
+	r = (x - n * PIO2_HI) - n * PIO2_LO;
+	switch ((n + quarter) & 3) {
+	case 0 :
+		return sin_poly(r);
+	case 1 :
+		return cos_poly(r);
+	case 2 :
+		return -sin_poly(r);
+	default :
+		return -cos_poly(r);
+	}
+}
+
+float
+fm_sinf(float x)
+{
+	return sin_quarter(x, 0);
+}
+
+float
+fm_cosf(float x)
+{
+	return sin_quarter(x, 1);
+}
+
+/* atan(z) for 0 <= z */
+static float
+atan_pos(float z)
+{
+	float	base = 0, zz;
+
+	if (z > TAN_3PI_8) {
+		base = 2 * PIO4;
+		z = -1.0f / z;
+	} else if (z > TAN_PI_8) {
+		base = PIO4;
+		z = (z - 1.0f) / (z + 1.0f);
+	}
+	zz = z * z;
+	return base + z + z * zz * (((8.05374449538e-2f * zz - 1.38776856032e-1f) *
+						zz + 1.99777106478e-1f) * zz - 3.33329491539e-1f);
+}
+
+float
+fm_atan2f(float y, float x)
+{
+	float	a;
+
+	if (x == 0) {
+		return (y > 0) ? 2 * PIO4 : (y < 0) ? -2 * PIO4 : 0;
+	}
+	a = atan_pos(((y < 0) ? -y : y) / ((x < 0) ? -x : x));
+	if (x < 0) {
+		a = 4 * PIO4 - a;
+	}
+	return (y < 0) ? -a : a;
+}
+
+float
+fm_sqrtf(float x)
+{
+#if defined(__ARM_FP) && (__ARM_FP & 4)
+	float	r;
+
+	__asm__ ("vsqrt.f32 %0, %1" : "=t" (r) : "t" (x));
+	return r;
+#else
+	union {
+		float		f;
+		uint32_t	i;
+	} u;
+	float	r;
+
+	if (x <= 0) {
+		return 0;
+	}
+	/* halve the exponent for a first guess, then Newton */
+	u.f = x;
+	u.i = (u.i >> 1) + 0x1fbd1df5;
+	r = u.f;
+	r = 0.5f * (r + x / r);
+	r = 0.5f * (r + x / r);
+	return 0.5f * (r + x / r);
+#endif
+}
+
+static void
+fill_tables(void)
+{
+	int		i;
+	float	v;
+
+	for (i = 0; i <= SIN_STEPS; i++) {
+		v = fm_sinf(i * (2 * FM_PI / SIN_STEPS)) * SIN_LIFT * FM_Q15_ONE;
+		v = (v > FM_Q15_ONE) ? FM_Q15_ONE : (v < -FM_Q15_ONE) ? -FM_Q15_ONE : v;
+		sin_tab[i] = (int16_t) (v + ((i > SIN_STEPS / 2) ? -0.5f : 0.5f));
+	}
+	for (i = 0; i <= ATAN_STEPS; i++) {
+		atan_tab[i] = (uint16_t) (atan_pos((float) i / ATAN_STEPS) *
+						(FM_TURN / (2 * FM_PI)) + 0.5f);
+	}
+}
+
+/* Q15 sine of binary angle 'a' */
+int16_t
+fm_sin_q15(uint16_t a)
+{
+	int		i = a >> 8, frac = a & 0xff;
+
+	if (sin_tab[SIN_STEPS / 4] == 0) {
+		fill_tables();
+	}
+	return sin_tab[i] + (((sin_tab[i + 1] - sin_tab[i]) * frac + 128) >> 8);
+}
+
+int16_t
+fm_cos_q15(uint16_t a)
+{
+	return fm_sin_q15(a + FM_TURN / 4);
+}
+
+/* Binary angle of (x, y), 0 along +x and a quarter turn along +y */
+uint16_t
+fm_atan2_q15(int32_t y, int32_t x)
+{
+	uint32_t	ax = (x < 0) ? -(uint32_t) x : (uint32_t) x;
+	uint32_t	ay = (y < 0) ? -(uint32_t) y : (uint32_t) y;
+	uint32_t	z, i, frac;
+	uint16_t	a;
+
+	if ((ax | ay) == 0) {
+		return 0;
+	}
+	if (atan_tab[ATAN_STEPS] == 0) {
+		fill_tables();
+	}
+	/* an eighth of a turn, z = small / big as Q16 */
+	if (ay <= ax) {
+		z = (uint32_t) (((uint64_t) ay << 16) / ax);
+	} else {
+		z = (uint32_t) (((uint64_t) ax << 16) / ay);
+	}
+	i = z >> 11;
+	frac = z & 0x7ff;
+	a = atan_tab[i];
+	if (i < ATAN_STEPS) {
+		a += ((atan_tab[i + 1] - atan_tab[i]) * frac + 0x400) >> 11;
+	}
+	if (ay > ax) {
+		a = FM_TURN / 4 - a;
+	}
+	if (x < 0) {
+		a = FM_TURN / 2 - a;
+	}
+	return (y < 0) ? (uint16_t) -a : a;
+}
+
+/* Square root of a Q16 number, in Q16 */
+uint32_t
+fm_sqrt_q16(uint32_t x)
+{
+	uint64_t	v = (uint64_t) x << 16, bit = (uint64_t) 1 << 46;
+	uint64_t	r = 0;
+
+	while (bit > v) {
+		bit >>= 2;
+	}
+	while (bit) {
+		if (v >= r + bit) {
+			v -= r + bit;
+			r = (r >> 1) + bit;
+		} else {
+			r >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint32_t) r;
+}
@@ -0,0 +1,41 @@
+/*
+ * fmath.h
+ *
+ * Quick trig and square roots for drawing, see fmath.c. The M4F only
+ * does single precision in hardware, and sin() and friends are double,
+ * so these work in float (and, for the fixed point ones, not at all).
+ *
+ * Errors, against the double libm functions:
+ *
+ *	fm_sinf, fm_cosf	1e-7 for |x| up to 1000, worse further out
+ *	fm_atan2f			3.4e-7 radians
+ *	fm_sqrtf			exact with the FPU, 1 part in 1e7 without it
+ *	fm_sin_q15/cos_q15	3 LSB (9e-5)
+ *	fm_atan2_q15		2 of FM_TURN (2e-4 radians)
+ *	fm_sqrt_q16			exact (rounded down)
+ *
+ * The fixed point angles are binary, FM_TURN to a turn, so they wrap
+ * round for free in a uint16_t.
+ */
+#ifndef __FMATH_H
+#define __FMATH_H
+
+#define FM_PI			3.14159265358979f
+#define FM_TURN			65536
+#define FM_Q15_ONE		32767
+#define FM_Q16_ONE		65536
+
+#define FM_Q16(f)			((int32_t) ((f) * 65536.0f))
+#define FM_MUL_Q16(a, b)	((int32_t) (((int64_t) (a) * (b)) >> 16))
+
+float fm_sinf(float x);
+float fm_cosf(float x);
+float fm_atan2f(float y, float x);
+float fm_sqrtf(float x);
+
+int16_t fm_sin_q15(uint16_t a);
+int16_t fm_cos_q15(uint16_t a);
+uint16_t fm_atan2_q15(int32_t y, int32_t x);
+uint32_t fm_sqrt_q16(uint32_t x);
+
+#endif /* generic header protector */
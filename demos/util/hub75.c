@@ -0,0 +1,1727 @@
+/*
+ * hub75.c -- Binary Code Modulation (BCM) engine for HUB75 panels
+ *
+ * With only one bit per color the panels can show eight colors. To
+ * get more we display each row several times per frame, once for
+ * each bit of the color depth, and leave it lit for a time that is
+ * proportional to the weight of the bit: 1, 2, 4, ... 128 units.
+ *
+ * The "on" time is generated by TIM3 channel 2 which is wired to OE
+ * (PC7) in one pulse mode, so it is exact no matter what else the CPU
+ * is doing. (The plain scan uses the same timer for its on time, see
+ * hub75_oe_pulse().) While one bit-plane is lit the next one is shifted into
+ * the panel, when both the pulse and the shift are complete the new
+ * data is latched and the next pulse started.
+ *
+ * Each channel goes through a gamma table as the planes are built, and
+ * with temporal dithering the part of each level below the BCM depth
+ * is carried over to the next frame (see bcm_levels()), so a low depth
+ * (and a high refresh rate) doesn't band as badly.
+ *
+ * Rows are only encoded again when they change, see bcm_new_frame().
+ * A frame buffer row can also be read from somewhere else, which is
+ * how the scroll regions in ticker.c move without being redrawn.
+ *
+ * The shifting is done as deferred work (see defer.c) so that it can
+ * be preempted by the console. Or, with hub75_bcm_dma(1), the CPU only
+ * converts the next plane into GPIOB BSRR words and a timer paced DMA
+ * stream writes them to the port (see dma_setup()), so the CPU time
+ * per refresh is a small fraction of what it takes to bit-bang it.
+ *
+ * A second chain of panels can hang off the GPIOA data pins. It shares
+ * the clock with the first, each clock sets both ports, so two chains
+ * shift in the time of one and refresh twice as fast as the same
+ * panels in one long chain.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/gpio.h>
+#include <libopencm3/stm32/timer.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
+#include "../util/util.h"
+#include "../util/hub75.h"
+
+const uint16_t hub75_colors[8] = {
+	LED_BLACK, LED_BLUE, LED_GREEN, LED_CYAN,
+	LED_RED, LED_MAGENTA, LED_YELLOW, LED_WHITE
+};
+
+/*
+ * Panel description, from hub75_init(). For each scan row, each chain
+ * and each panel in the chain (in the order they are clocked, farthest
+ * from the connector first) there is a span: where the first top and
+ * bottom pixels are in the frame buffer and the step to the next.
+ * Orientation is all in the spans, so it costs nothing per pixel.
+ */
+struct hub75_span {
+	uint16_t	top;
+	uint16_t	bot;
+	int16_t		step;
+};
+
+static struct hub75_span spans[32 * HUB75_MAX_CHAIN * HUB75_MAX_CHAINS];
+static int scan_rows;
+static int scan_clocks;				/* per chain */
+static int scan_chain;
+static int scan_ports;				/* chains in parallel */
+static int plane_len;				/* clocks of all of the chains */
+static int scan_width;				/* clocks per panel */
+static uint16_t *(*scan_frame)(void);
+
+/*
+ * The bit-planes, for each row there are 'depth' planes of 'plane_len'
+ * bytes, the first chain's clocks then the second's. Each byte is a
+ * pixel pair: bits 2, 1, 0 are R, G, B of the top pixel and bits 5, 4,
+ * 3 are R, G, B of the bottom pixel. Only the CPU reads them (for DMA
+ * bcm_prep() turns them into dma_words), so they live in CCM, and as
+ * every row is encoded before it is first shown nothing clears them.
+ */
+static uint8_t planes[HUB75_MAX_DEPTH * HUB75_MAX_SHIFT] CCM_DATA;
+
+/*
+ * BSRR value for each pixel pair, sets and clears all six data pins
+ * with one write. Indexed by HUB75_PAIR(top, bottom).
+ */
+#define PAIR_BITS(i, r1, g1, b1, r2, g2, b2)	\
+					((((i) & 0x04) ? r1 : 0) | (((i) & 0x02) ? g1 : 0) | \
+					 (((i) & 0x01) ? b1 : 0) | (((i) & 0x20) ? r2 : 0) | \
+					 (((i) & 0x10) ? g2 : 0) | (((i) & 0x08) ? b2 : 0))
+#define PAIR_SET(i)	PAIR_BITS(i, HUB75_R1, HUB75_G1, HUB75_B1, \
+							HUB75_R2, HUB75_G2, HUB75_B2)
+#define PAIR_SET_PA(i)	PAIR_BITS(i, HUB75_PA_R1, HUB75_PA_G1, HUB75_PA_B1, \
+							HUB75_PA_R2, HUB75_PA_G2, HUB75_PA_B2)
+#define PAIR(i)		(PAIR_SET(i) | ((HUB75_DATA_PINS & ~PAIR_SET(i)) << 16))
+#define PAIR_PA(i)	(PAIR_SET_PA(i) | ((HUB75_PA_DATA_PINS & ~PAIR_SET_PA(i)) << 16))
+#define PAIR4(P, i)		P(i), P(i + 1), P(i + 2), P(i + 3)
+#define PAIR16(P, i)	PAIR4(P, i), PAIR4(P, i + 4), PAIR4(P, i + 8), PAIR4(P, i + 12)
+
+const uint32_t hub75_pair_bsrr[64] = {
+	PAIR16(PAIR, 0), PAIR16(PAIR, 16), PAIR16(PAIR, 32), PAIR16(PAIR, 48)
+};
+
+const uint32_t hub75_pair_bsrr_pa[64] = {
+	PAIR16(PAIR_PA, 0), PAIR16(PAIR_PA, 16), PAIR16(PAIR_PA, 32), PAIR16(PAIR_PA, 48)
+};
+
+/*
+ * Gamma correction, RGB565 channel value (5 or 6 bits) to linear
+ * drive level, and the dithering error carried between frames for
+ * each pixel (in CCM with the planes).
+ */
+#define GAMMA_BITS	12
+static uint16_t gamma5[32];
+static uint16_t gamma6[64];
+static float cur_gamma = HUB75_DEFAULT_GAMMA;
+static int dither;
+static uint16_t dither_err[HUB75_MAX_SHIFT * 2] CCM_DATA;
+
+static uint16_t *cur_fb;			/* frame buffer being displayed */
+static volatile uint32_t stale;		/* scan rows that need encoding */
+
+/*
+ * Dirty rows. The demo marks frame buffer rows it changes with
+ * hub75_dirty() and hands the finished buffer over with
+ * hub75_dirty_done(). For each frame buffer we keep the rows in which
+ * it may differ from what is encoded. When one is shown, its rows
+ * are checked against a hash of what was last encoded and only the
+ * scan rows (row_mask[]) reading rows which really changed get
+ * encoded again. The others may now differ in those rows too.
+ */
+#define DIRTY_WORDS	(HUB75_MAX_HEIGHT / 32)
+#define DIRTY_BUFS	3
+static uint32_t dirty_draw[DIRTY_WORDS];	/* marked in the frame being drawn */
+static struct dirty_buf {
+	const uint16_t	*fb;
+	uint32_t		diff[DIRTY_WORDS];
+} dirty_bufs[DIRTY_BUFS];
+static uint32_t row_hash[HUB75_MAX_HEIGHT];
+static uint32_t row_mask[HUB75_MAX_HEIGHT];
+static int fb_width;
+static int fb_height;
+static int track_dirty;
+static int rehash = 1;						/* re-encode everything */
+
+/*
+ * Rows read from somewhere other than the frame buffer (NULL for the
+ * frame buffer row), see hub75_row_source(). Rows whose source moved
+ * are hashed again at the next frame.
+ */
+static const uint16_t *row_src[HUB75_MAX_HEIGHT];
+static uint32_t src_moved[DIRTY_WORDS];
+static int fb_swapped;						/* a panel reads down columns */
+static struct hub75_encode_stats enc_stats;
+
+/*
+ * Refresh statistics, gathered as each row is lit and published once
+ * a second, plus the frame boundary hook.
+ */
+static struct hub75_scan_stats scan_stats;
+static void (*frame_hook)(const uint16_t *fb, int new_frame);
+static const uint16_t *lit_fb;
+static uint32_t lit_last;			/* DWT when the last row was lit */
+static uint32_t win_start;			/* DWT when this second started */
+static uint32_t win_frames, win_swaps, win_rows, win_row_max;
+static uint64_t win_row_total;
+
+/* The plain row scan, run from TIM5 */
+static void (*scan_func)(void);
+static volatile uint32_t scan_busy;
+
+static int depth;
+static int unit = HUB75_DEFAULT_UNIT;
+static uint32_t brightness = HUB75_BRIGHTNESS_MAX;
+static uint32_t row_ticks;			/* TIM3 ticks per row of the plain scan */
+static uint32_t row_on;				/* of which OE is low */
+static volatile int running;
+static volatile int stopped = 1;
+static volatile uint32_t frames;
+static volatile uint32_t busy;		/* cycles spent shifting and encoding */
+
+/*
+ * What the engine is waiting for before it can latch the next
+ * plane. In DMA mode the plane after that must also have been
+ * converted to BSRR words so its transfer can start right away.
+ */
+#define WAIT_PULSE	1		/* the OE pulse of the lit plane has ended */
+#define WAIT_SHIFT	2		/* the next plane is in the shift registers */
+#define WAIT_PREP	4		/* the DMA words for the one after are ready */
+
+static volatile uint32_t waiting;
+static int shift_row;				/* plane going into the panel */
+static int shift_bit;
+static int prep_row;				/* plane going into dma_words[dma_buf] */
+static int prep_bit;
+
+static int use_dma;
+static int dma_buf;
+static uint32_t dma_words[2][HUB75_MAX_CLOCKS];
+static uint32_t dma_words_pa[2][HUB75_MAX_CLOCKS];	/* the GPIOA chain */
+
+static struct hub75_chain_stats chain_stats;
+static uint32_t shift_start;		/* DWT when the DMA shift started */
+
+/*
+ * The animation playing, if any. A new one (or none) is picked up at
+ * the next frame boundary. A whole frame animation is shifted from
+ * where it is, a delta coded one is played in 'planes'.
+ */
+static const struct hub75_anim *anim;
+static const struct hub75_anim *anim_next;
+static volatile int anim_change;
+static int anim_fps, anim_next_fps;
+static uint32_t anim_start;			/* mtime() at frame 0 */
+static volatile int anim_frame;		/* on display */
+static uint32_t anim_pos;			/* in 'data' of the next frame's changes */
+static uint32_t anim_loop;			/* of the second frame's */
+static const uint8_t *anim_planes;
+
+static void bcm_shift(void);
+static void bcm_prep(void);
+
+/* Move a (row, bit) position on to the next plane to display */
+static void
+bcm_advance(int *row, int *bit)
+{
+	if (++(*bit) == depth) {
+		*bit = 0;
+		if (++(*row) == scan_rows) {
+			*row = 0;
+		}
+	}
+}
+
+/*
+ * Turn an RGB565 pixel into R, G, B levels of 'depth' bits. The gamma
+ * tables give a linear drive level of GAMMA_BITS, without dithering
+ * it is rounded to the depth. With dithering the 4 bits below the
+ * depth are left in '*err' (one nibble per channel) and added back in
+ * the next frame, so averaged over frames the level is right to 4
+ * more bits than the panel shows.
+ */
+static void
+bcm_levels(uint32_t pix, uint16_t *err, uint32_t *lv)
+{
+	uint32_t	lin[3], v, e, max;
+	int			c, s;
+
+	lin[0] = gamma5[pix >> 11];
+	lin[1] = gamma6[(pix >> 5) & 0x3f];
+	lin[2] = gamma5[pix & 0x1f];
+	max = (1 << depth) - 1;
+	s = GAMMA_BITS - 4 - depth;
+	e = *err;
+	for (c = 0; c < 3; c++) {
+		v = lin[c] >> s;
+		if (dither) {
+			v += (e >> (c * 4)) & 0xf;
+			e = (e & ~(0xf << (c * 4))) | ((v & 0xf) << (c * 4));
+		} else {
+			v += 8;
+		}
+		v >>= 4;
+		lv[c] = (v > max) ? max : v;
+	}
+	*err = e;
+}
+
+/* Where pixel 'off' of the frame buffer is really read from */
+static inline const uint16_t *
+pixel_src(const uint16_t *fb, int off)
+{
+	const uint16_t	*src = row_src[off / fb_width];
+
+	return (src) ? src + off % fb_width : fb + off;
+}
+
+/* Convert one row of the frame buffer into 'depth' bit-planes */
+static void
+bcm_encode(int row)
+{
+	const struct hub75_span	*sp = &spans[row * scan_ports * scan_chain];
+	uint8_t		*p = &planes[row * depth * plane_len];
+	uint16_t	*err = &dither_err[row * plane_len * 2];
+	const uint16_t	*top, *bot;
+	int			j, n, i;
+	uint32_t	lv[6];
+
+	for (j = 0; j < scan_ports * scan_chain; j++, sp++) {
+		top = pixel_src(cur_fb, sp->top);
+		bot = pixel_src(cur_fb, sp->bot);
+		for (n = 0; n < scan_width; n++, p++) {
+			bcm_levels(*top, err++, &lv[0]);
+			bcm_levels(*bot, err++, &lv[3]);
+			for (i = 0; i < depth; i++) {
+				p[i * plane_len] =
+					(((lv[0] >> i) & 1) << 2) | (((lv[1] >> i) & 1) << 1) |
+					((lv[2] >> i) & 1) | (((lv[3] >> i) & 1) << 5) |
+					(((lv[4] >> i) & 1) << 4) | (((lv[5] >> i) & 1) << 3);
+			}
+			top += sp->step;
+			bot += sp->step;
+		}
+	}
+	stale &= ~(1U << row);
+}
+
+/* Hash of one frame buffer row, to see if it has really changed */
+static uint32_t
+bcm_row_hash(const uint16_t *fb, int y)
+{
+	const uint32_t	*w = (const uint32_t *) ((row_src[y]) ? row_src[y] :
+											fb + y * fb_width);
+	uint32_t		h = 0;
+	int				n;
+
+	for (n = fb_width / 2; n > 0; n--) {
+		h = ((h << 5) | (h >> 27)) ^ *w++;
+	}
+	return h;
+}
+
+/* Find (or make) the dirty row record for a frame buffer */
+static struct dirty_buf *
+dirty_find(const uint16_t *fb)
+{
+	int	i;
+
+	for (i = 0; i < DIRTY_BUFS; i++) {
+		if (dirty_bufs[i].fb == fb) {
+			return &dirty_bufs[i];
+		}
+	}
+	for (i = 0; i < DIRTY_BUFS; i++) {
+		if (dirty_bufs[i].fb == 0) {
+			dirty_bufs[i].fb = fb;
+			return &dirty_bufs[i];
+		}
+	}
+	return 0;
+}
+
+/*
+ * At the frame boundary, work out which scan rows need encoding to
+ * show frame buffer 'fb'.
+ */
+static void
+bcm_new_frame(uint16_t *fb)
+{
+	struct dirty_buf	*db;
+	uint32_t	cand[DIRTY_WORDS];
+	uint32_t	h, moved;
+	int			i, j, y;
+
+	if (fb != cur_fb) {
+		enc_stats.new_frames++;
+		db = dirty_find(fb);
+		for (i = 0; i < DIRTY_WORDS; i++) {
+			cand[i] = (rehash || ! track_dirty || ! db) ? ~0U : db->diff[i];
+			for (j = 0; j < DIRTY_BUFS; j++) {
+				dirty_bufs[j].diff[i] |= cand[i];
+			}
+			if (db) {
+				db->diff[i] = 0;
+			}
+		}
+	} else {
+		for (i = 0; i < DIRTY_WORDS; i++) {
+			cand[i] = (rehash) ? ~0U : 0;
+		}
+	}
+	/* rows now read from elsewhere may differ in every frame buffer */
+	for (i = 0; i < DIRTY_WORDS; i++) {
+		moved = src_moved[i];
+		src_moved[i] = 0;
+		cand[i] |= moved;
+		for (j = 0; j < DIRTY_BUFS; j++) {
+			dirty_bufs[j].diff[i] |= moved;
+		}
+	}
+	cur_fb = fb;
+	for (y = 0; y < fb_height; y++) {
+		if ((cand[y >> 5] & (1U << (y & 31))) == 0) {
+			continue;
+		}
+		h = bcm_row_hash(fb, y);
+		if ((h != row_hash[y]) || rehash) {
+			row_hash[y] = h;
+			stale |= row_mask[y];
+		}
+	}
+	rehash = 0;
+	/* dithering changes every frame */
+	if (dither) {
+		stale = ~0;
+	}
+}
+
+/*
+ * Apply the changes for one delta coded frame to 'planes', returns -1
+ * if they don't fit.
+ */
+static int
+anim_apply(void)
+{
+	const uint8_t	*d = anim->data;
+	uint32_t		size = anim->rows * anim->depth * anim->clocks;
+	uint32_t		off = 0, skip, len;
+
+	for (;;) {
+		if (anim_pos + 4 > anim->bytes) {
+			return -1;
+		}
+		skip = d[anim_pos] | (d[anim_pos + 1] << 8);
+		len = d[anim_pos + 2] | (d[anim_pos + 3] << 8);
+		anim_pos += 4;
+		if (len == 0) {
+			return 0;
+		}
+		off += skip;
+		if ((off + len > size) || (anim_pos + len > anim->bytes)) {
+			return -1;
+		}
+		memcpy(&planes[off], &d[anim_pos], len);
+		off += len;
+		anim_pos += len;
+	}
+}
+
+/*
+ * At the frame boundary, start or stop an animation if asked to and
+ * move the one playing on to the frame for the time. Returns 0 if
+ * there is no animation to show.
+ */
+static int
+anim_update(void)
+{
+	uint32_t	size, want;
+	int			bad = 0;
+
+	if (anim_change) {
+		anim_change = 0;
+		anim = anim_next;
+		anim_fps = anim_next_fps;
+		anim_frame = 0;
+		anim_start = mtime();
+		if (anim == NULL) {
+			/* the frame buffer has to be encoded again */
+			anim_frame = -1;
+			rehash = 1;
+			return 0;
+		}
+		if (anim->flags & HUB75_ANIM_DELTA) {
+			memset(planes, 0, anim->rows * anim->depth * anim->clocks);
+			anim_pos = 0;
+			bad = anim_apply();
+			anim_loop = anim_pos;
+		}
+	}
+	if (anim == NULL) {
+		return 0;
+	}
+
+	size = anim->rows * anim->depth * anim->clocks;
+	want = (uint32_t) (((uint64_t) (mtime() - anim_start) * anim_fps / 1000) %
+						anim->frames);
+	if ((anim->flags & HUB75_ANIM_DELTA) == 0) {
+		anim_frame = want;
+		anim_planes = &anim->data[want * size];
+		return 1;
+	}
+	while ((anim_frame != (int) want) && ! bad) {
+		bad = anim_apply();
+		if (++anim_frame == anim->frames) {
+			anim_frame = 0;
+			anim_pos = anim_loop;
+		}
+	}
+	anim_planes = planes;
+	if (bad) {
+		/* not what it said it was, show the frame buffer again */
+		anim = NULL;
+		anim_frame = -1;
+		rehash = 1;
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ * Return the codes for one bit-plane. At the start of a frame this
+ * picks up the frame buffer to display, and at the start of each row
+ * it encodes the row if it hasn't been done for this frame. While an
+ * animation plays the frame buffer is left alone and the planes come
+ * straight from the animation.
+ */
+static const uint8_t *
+bcm_plane(int row, int bit)
+{
+	static uint32_t	frame_cycles;
+	uint32_t		start;
+
+	if (bit == 0) {
+		start = dwt_read_cycle_counter();
+		if (row == 0) {
+			if (frame_cycles > enc_stats.cycles_max) {
+				enc_stats.cycles_max = frame_cycles;
+			}
+			frame_cycles = 0;
+			if (! anim_update()) {
+				bcm_new_frame(scan_frame());
+			}
+			frames++;
+			enc_stats.frames++;
+		}
+		if ((stale & (1U << row)) && ! anim) {
+			bcm_encode(row);
+			enc_stats.rows++;
+		}
+		start = dwt_read_cycle_counter() - start;
+		frame_cycles += start;
+		enc_stats.cycles += start;
+	}
+	if (anim) {
+		return &anim_planes[(row * depth + bit) * plane_len];
+	}
+	return &planes[(row * depth + bit) * plane_len];
+}
+
+/* Time taken to shift one plane into all of the chains */
+static void
+chain_shifted(uint32_t cycles)
+{
+	chain_stats.shifts++;
+	chain_stats.cycles += cycles;
+	if (cycles > chain_stats.cycles_max) {
+		chain_stats.cycles_max = cycles;
+	}
+}
+
+/*
+ * Start streaming a plane's worth of BSRR words from dma_words[buf] to
+ * GPIOB, and from dma_words_pa[buf] to GPIOA for a second chain.
+ */
+static void
+dma_start(int buf)
+{
+	dma_clear_interrupt_flags(DMA2, DMA_STREAM2, DMA_TCIF | DMA_HTIF |
+								DMA_TEIF | DMA_DMEIF | DMA_FEIF);
+	dma_set_memory_address(DMA2, DMA_STREAM2, (uint32_t) dma_words[buf]);
+	dma_set_number_of_data(DMA2, DMA_STREAM2, scan_clocks);
+	dma_enable_stream(DMA2, DMA_STREAM2);
+	if (scan_ports > 1) {
+		dma_clear_interrupt_flags(DMA2, DMA_STREAM3, DMA_TCIF | DMA_HTIF |
+									DMA_TEIF | DMA_DMEIF | DMA_FEIF);
+		dma_set_memory_address(DMA2, DMA_STREAM3, (uint32_t) dma_words_pa[buf]);
+		dma_set_number_of_data(DMA2, DMA_STREAM3, scan_clocks);
+		dma_enable_stream(DMA2, DMA_STREAM3);
+	}
+	shift_start = dwt_read_cycle_counter();
+	TIM_CR1(TIM8) |= TIM_CR1_CEN;
+}
+
+/* Latch what was shifted in and light it for the weight of its bit */
+static void
+bcm_latch(void)
+{
+	uint32_t	slot;
+
+	if (! running) {
+		stopped = 1;
+		return;
+	}
+
+	/* OE is off between pulses so it is safe to change rows */
+	hub75_set_row(shift_row);
+	GPIO_BSRR(GPIOC) = HUB75_LAT;
+	GPIO_BSRR(GPIOC) = HUB75_LAT << 16;
+
+	/* the slot is always the bit's weight, brightness sets how much is lit */
+	slot = unit << shift_bit;
+	TIM_ARR(TIM3) = slot;
+	TIM_CCR2(TIM3) = slot + 1 - (slot * brightness) / HUB75_BRIGHTNESS_MAX;
+	TIM_CR1(TIM3) |= TIM_CR1_CEN;
+	if (shift_bit == 0) {
+		hub75_scan_mark(shift_row, cur_fb);
+	}
+
+	if (use_dma) {
+		/* the prepared plane goes out now, prepare the one after */
+		waiting = WAIT_PULSE | WAIT_SHIFT | WAIT_PREP;
+		shift_row = prep_row;
+		shift_bit = prep_bit;
+		dma_start(dma_buf);
+		dma_buf ^= 1;
+		bcm_advance(&prep_row, &prep_bit);
+		defer_work(bcm_prep);
+	} else {
+		waiting = WAIT_PULSE | WAIT_SHIFT;
+		bcm_advance(&shift_row, &shift_bit);
+		defer_work(bcm_shift);
+	}
+}
+
+/* Note that something we were waiting for is done */
+static void
+bcm_event(uint32_t ev)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	waiting &= ~ev;
+	if (waiting == 0) {
+		bcm_latch();
+	}
+	cm_mask_interrupts(mask);
+}
+
+/* Deferred work, shift in the next bit-plane with the CPU */
+static void
+bcm_shift(void)
+{
+	const uint8_t	*code, *code_pa;
+	uint32_t		start, shift;
+	int				k;
+
+	start = dwt_read_cycle_counter();
+	code = bcm_plane(shift_row, shift_bit);
+	shift = dwt_read_cycle_counter();
+	if (scan_ports > 1) {
+		code_pa = code + scan_clocks;
+		for (k = 0; k < scan_clocks; k++) {
+			GPIO_BSRR(GPIOB) = hub75_pair_bsrr[*code++];
+			GPIO_BSRR(GPIOA) = hub75_pair_bsrr_pa[*code_pa++];
+			GPIO_BSRR(GPIOC) = HUB75_CLK;
+			GPIO_BSRR(GPIOC) = HUB75_CLK << 16;
+		}
+	} else {
+		for (k = 0; k < scan_clocks; k++) {
+			GPIO_BSRR(GPIOB) = hub75_pair_bsrr[*code++];
+			GPIO_BSRR(GPIOC) = HUB75_CLK;
+			GPIO_BSRR(GPIOC) = HUB75_CLK << 16;
+		}
+	}
+	chain_shifted(dwt_read_cycle_counter() - shift);
+	busy += dwt_read_cycle_counter() - start;
+	bcm_event(WAIT_SHIFT);
+}
+
+/* Deferred work, convert the plane after next into BSRR words */
+static void
+bcm_prep(void)
+{
+	const uint8_t	*code;
+	uint32_t		*w;
+	uint32_t		start;
+	int				k;
+
+	start = dwt_read_cycle_counter();
+	code = bcm_plane(prep_row, prep_bit);
+	w = dma_words[dma_buf];
+	for (k = 0; k < scan_clocks; k++) {
+		*w++ = hub75_pair_bsrr[*code++];
+	}
+	if (scan_ports > 1) {
+		w = dma_words_pa[dma_buf];
+		for (k = 0; k < scan_clocks; k++) {
+			*w++ = hub75_pair_bsrr_pa[*code++];
+		}
+	}
+	busy += dwt_read_cycle_counter() - start;
+	bcm_event(WAIT_PREP);
+}
+
+/*
+ * Deferred work, get the first plane into the panel. With DMA that
+ * means preparing and sending plane 0, then preparing plane 1.
+ */
+static void
+bcm_prime(void)
+{
+	if (! use_dma) {
+		bcm_shift();
+		return;
+	}
+	dma_buf = 0;
+	bcm_prep();
+	shift_row = prep_row;
+	shift_bit = prep_bit;
+	waiting |= WAIT_PREP;
+	dma_start(0);
+	dma_buf = 1;
+	bcm_advance(&prep_row, &prep_bit);
+	bcm_prep();
+}
+
+/* End of the OE pulse */
+void
+tim3_isr(void)
+{
+	if (timer_get_flag(TIM3, TIM_SR_UIF)) {
+		timer_clear_flag(TIM3, TIM_SR_UIF);
+		if (! stopped) {
+			bcm_event(WAIT_PULSE);
+		}
+	}
+}
+
+/* All of the words have gone out */
+void
+dma2_stream2_isr(void)
+{
+	if (dma_get_interrupt_flag(DMA2, DMA_STREAM2, DMA_TCIF)) {
+		dma_clear_interrupt_flags(DMA2, DMA_STREAM2, DMA_TCIF);
+		/* the last word is on the pins, wait for its clock edge */
+		while (TIM_CR1(TIM8) & TIM_CR1_CEN) ;
+		chain_shifted(dwt_read_cycle_counter() - shift_start);
+		bcm_event(WAIT_SHIFT);
+	}
+}
+
+/*
+ * Set up TIM8 and DMA2 to clock out a row. TIM8 runs at 168MHz, the
+ * CLK line (PC9) is channel 4 in PWM2 mode so it rises 3/4 of the
+ * way through each period. The channel 1 compare early in each period
+ * requests a DMA transfer (DMA2 stream 2, channel 7) of the next word
+ * into GPIOB's BSRR. One pulse mode with the repetition counter stops
+ * the timer after exactly 'clocks' periods. With a second chain the
+ * channel 2 compare, a tick later, does the same for GPIOA with DMA2
+ * stream 3 (also channel 7), both words are on the pins well before
+ * the clock rises.
+ */
+static void
+dma_setup(void)
+{
+	rcc_periph_clock_enable(RCC_TIM8);
+	rcc_periph_reset_pulse(RST_TIM8);
+	timer_set_mode(TIM8, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+	timer_set_prescaler(TIM8, 0);
+	timer_set_period(TIM8, HUB75_DMA_PERIOD - 1);
+	timer_one_shot_mode(TIM8);
+	timer_set_repetition_counter(TIM8, scan_clocks - 1);
+	timer_set_oc_value(TIM8, TIM_OC1, 1);
+	timer_set_oc_mode(TIM8, TIM_OC4, TIM_OCM_PWM2);
+	timer_set_oc_value(TIM8, TIM_OC4, (HUB75_DMA_PERIOD * 3) / 4);
+	timer_enable_oc_output(TIM8, TIM_OC4);
+	timer_enable_break_main_output(TIM8);
+	/* load the repetition counter */
+	timer_generate_event(TIM8, TIM_EGR_UG);
+	TIM_DIER(TIM8) |= TIM_DIER_CC1DE;
+
+	rcc_periph_clock_enable(RCC_DMA2);
+	dma_stream_reset(DMA2, DMA_STREAM2);
+	dma_channel_select(DMA2, DMA_STREAM2, DMA_SxCR_CHSEL_7);
+	dma_set_priority(DMA2, DMA_STREAM2, DMA_SxCR_PL_VERY_HIGH);
+	dma_set_memory_size(DMA2, DMA_STREAM2, DMA_SxCR_MSIZE_32BIT);
+	dma_set_peripheral_size(DMA2, DMA_STREAM2, DMA_SxCR_PSIZE_32BIT);
+	dma_enable_memory_increment_mode(DMA2, DMA_STREAM2);
+	dma_set_transfer_mode(DMA2, DMA_STREAM2, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+	dma_set_peripheral_address(DMA2, DMA_STREAM2,
+								(uint32_t) &GPIO_BSRR(GPIOB));
+	dma_enable_transfer_complete_interrupt(DMA2, DMA_STREAM2);
+	nvic_set_priority(NVIC_DMA2_STREAM2_IRQ, IRQ_PRI_PANEL);
+	nvic_enable_irq(NVIC_DMA2_STREAM2_IRQ);
+
+	if (scan_ports > 1) {
+		timer_set_oc_value(TIM8, TIM_OC2, 2);
+		TIM_DIER(TIM8) |= TIM_DIER_CC2DE;
+		dma_stream_reset(DMA2, DMA_STREAM3);
+		dma_channel_select(DMA2, DMA_STREAM3, DMA_SxCR_CHSEL_7);
+		dma_set_priority(DMA2, DMA_STREAM3, DMA_SxCR_PL_VERY_HIGH);
+		dma_set_memory_size(DMA2, DMA_STREAM3, DMA_SxCR_MSIZE_32BIT);
+		dma_set_peripheral_size(DMA2, DMA_STREAM3, DMA_SxCR_PSIZE_32BIT);
+		dma_enable_memory_increment_mode(DMA2, DMA_STREAM3);
+		dma_set_transfer_mode(DMA2, DMA_STREAM3, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+		dma_set_peripheral_address(DMA2, DMA_STREAM3,
+									(uint32_t) &GPIO_BSRR(GPIOA));
+	}
+
+	/* CLK now belongs to TIM8 */
+	gpio_mode_setup(GPIOC, GPIO_MODE_AF, GPIO_PUPD_NONE, HUB75_CLK);
+	gpio_set_output_options(GPIOC, GPIO_OTYPE_PP, GPIO_OSPEED_50MHZ, HUB75_CLK);
+	gpio_set_af(GPIOC, GPIO_AF3, HUB75_CLK);
+}
+
+/*
+ * Helpers for the plain (one bit per color) row scan in the demos.
+ * Clock in 'n' pixel pairs (a multiple of 4) from 'top' and 'bot',
+ * stepping both by 'step' (1 or -1), one BSRR write per pair.
+ */
+#define CLOCK_PAIR()	\
+	GPIO_BSRR(GPIOB) = hub75_pair_bsrr[HUB75_PAIR(RGB565_TO_3BIT(*top), \
+										RGB565_TO_3BIT(*bot))]; \
+	GPIO_BSRR(GPIOC) = HUB75_CLK; \
+	GPIO_BSRR(GPIOC) = HUB75_CLK << 16; \
+	top += step; bot += step
+
+void
+hub75_clock_pairs(const uint16_t *top, const uint16_t *bot, int n, int step)
+{
+	for (n >>= 2; n > 0; n--) {
+		CLOCK_PAIR();
+		CLOCK_PAIR();
+		CLOCK_PAIR();
+		CLOCK_PAIR();
+	}
+}
+
+/* Put the row address on A - E with one write */
+void
+hub75_set_row(int row)
+{
+	GPIO_BSRR(GPIOB) = ((~row & 0x1f) << (HUB75_ROW_SHIFT + 16)) |
+						((row & 0x1f) << HUB75_ROW_SHIFT);
+}
+
+/*
+ * A panel of each chain at once, the span 'sp' on GPIOB and 'sp_pa' on
+ * GPIOA, with the one clock.
+ */
+static void
+clock_pairs_pa(const uint16_t *fb, const struct hub75_span *sp,
+				const struct hub75_span *sp_pa)
+{
+	const uint16_t	*top = pixel_src(fb, sp->top);
+	const uint16_t	*bot = pixel_src(fb, sp->bot);
+	const uint16_t	*top_pa = pixel_src(fb, sp_pa->top);
+	const uint16_t	*bot_pa = pixel_src(fb, sp_pa->bot);
+	int				n;
+
+	for (n = scan_width; n > 0; n--) {
+		GPIO_BSRR(GPIOB) = hub75_pair_bsrr[HUB75_PAIR(RGB565_TO_3BIT(*top),
+										RGB565_TO_3BIT(*bot))];
+		GPIO_BSRR(GPIOA) = hub75_pair_bsrr_pa[HUB75_PAIR(RGB565_TO_3BIT(*top_pa),
+										RGB565_TO_3BIT(*bot_pa))];
+		GPIO_BSRR(GPIOC) = HUB75_CLK;
+		GPIO_BSRR(GPIOC) = HUB75_CLK << 16;
+		top += sp->step;
+		bot += sp->step;
+		top_pa += sp_pa->step;
+		bot_pa += sp_pa->step;
+	}
+}
+
+/*
+ * Address scan row 'row' and clock in its pixels from 'fb', using
+ * the geometry given to hub75_init(). Latching is up to the caller.
+ */
+void
+hub75_scan_row(const uint16_t *fb, int row)
+{
+	const struct hub75_span	*sp = &spans[row * scan_ports * scan_chain];
+	int		j;
+
+	hub75_set_row(row);
+	if (scan_ports > 1) {
+		for (j = 0; j < scan_chain; j++, sp++) {
+			clock_pairs_pa(fb, sp, sp + scan_chain);
+		}
+		return;
+	}
+	for (j = 0; j < scan_chain; j++, sp++) {
+		hub75_clock_pairs(pixel_src(fb, sp->top), pixel_src(fb, sp->bot),
+							scan_width, sp->step);
+	}
+}
+
+/*
+ * Read frame buffer row 'y' from 'src' (fb_width pixels) instead, or
+ * from the frame buffer again if 'src' is NULL. This can be called
+ * from the frame function, the change shows from that frame on.
+ * Rows can't be redirected if a panel is mounted on its side, as its
+ * scan rows read down the frame buffer columns, it returns -1.
+ */
+int
+hub75_row_source(int y, const uint16_t *src)
+{
+	uint32_t	mask;
+
+	if (fb_swapped || (y < 0) || (y >= fb_height)) {
+		return -1;
+	}
+	if (row_src[y] != src) {
+		mask = cm_mask_interrupts(1);
+		row_src[y] = src;
+		src_moved[y >> 5] |= 1U << (y & 31);
+		cm_mask_interrupts(mask);
+	}
+	return 0;
+}
+
+/*
+ * Packed frame buffers, 3 bit color in a nibble per pixel, the even
+ * pixel of each pair in the low nibble. They are a quarter the size of
+ * RGB565 ones and the plain scan reads them as they are.
+ */
+void
+hub75_packed_pixel(uint8_t *fb, int width, int x, int y, int c)
+{
+	uint8_t	*p = fb + ((y * width + x) >> 1);
+
+	if (x & 1) {
+		*p = (*p & 0x0f) | (c << 4);
+	} else {
+		*p = (*p & 0xf0) | c;
+	}
+}
+
+/* Fill 'n' pixels of row 'y' from 'x' with color 'c', a word at a time */
+void
+hub75_packed_span(uint8_t *fb, int width, int x, int y, int n, int c)
+{
+	uint8_t		*p = fb + ((y * width + x) >> 1);
+	uint32_t	w = (uint32_t) c * 0x11111111U;
+
+	if ((x & 1) && (n > 0)) {
+		*p = (*p & 0x0f) | (c << 4);
+		p++;
+		n--;
+	}
+	for (; (n >= 2) && ((uint32_t) p & 3); n -= 2) {
+		*p++ = w;
+	}
+	for (; n >= 8; n -= 8, p += 4) {
+		*(uint32_t *) p = w;
+	}
+	for (; n >= 2; n -= 2) {
+		*p++ = w;
+	}
+	if (n) {
+		*p = (*p & 0xf0) | c;
+	}
+}
+
+/*
+ * RGB565 versions of the two above, the span filling a word (two
+ * pixels) at a time.
+ */
+void
+hub75_rgb565_pixel(uint16_t *fb, int width, int x, int y, uint16_t c)
+{
+	fb[y * width + x] = c;
+}
+
+void
+hub75_rgb565_span(uint16_t *fb, int width, int x, int y, int n, uint16_t c)
+{
+	uint16_t	*p = fb + y * width + x;
+	uint32_t	w = c * 0x10001U;
+
+	if (((uint32_t) p & 2) && (n > 0)) {
+		*p++ = c;
+		n--;
+	}
+	for (; n >= 2; n -= 2, p += 2) {
+		*(uint32_t *) p = w;
+	}
+	if (n) {
+		*p = c;
+	}
+}
+
+#define CLOCK_CODE(code)	\
+	GPIO_BSRR(GPIOB) = hub75_pair_bsrr[code]; \
+	GPIO_BSRR(GPIOC) = HUB75_CLK; \
+	GPIO_BSRR(GPIOC) = HUB75_CLK << 16
+
+/*
+ * Clock in 'n' pixel pairs from a packed frame buffer, 'top' and 'bot'
+ * are pixel offsets. A byte of each row covers two pairs when the
+ * pixels run along the bytes (forwards from an even pixel or backwards
+ * from an odd one), which they do unless a panel is placed at an odd
+ * x or on its side.
+ */
+static void
+clock_packed(const uint8_t *fb, int top, int bot, int n, int step)
+{
+	const uint8_t	*t = fb + (top >> 1);
+	const uint8_t	*b = fb + (bot >> 1);
+	uint32_t		tb, bb;
+
+	if ((step == 1) && ((top | bot) & 1) == 0) {
+		for (n >>= 1; n > 0; n--) {
+			tb = *t++;
+			bb = *b++;
+			CLOCK_CODE(HUB75_PAIR(tb & 7, bb & 7));
+			CLOCK_CODE(HUB75_PAIR((tb >> 4) & 7, (bb >> 4) & 7));
+		}
+	} else if ((step == -1) && (top & bot & 1)) {
+		for (n >>= 1; n > 0; n--) {
+			tb = *t--;
+			bb = *b--;
+			CLOCK_CODE(HUB75_PAIR((tb >> 4) & 7, (bb >> 4) & 7));
+			CLOCK_CODE(HUB75_PAIR(tb & 7, bb & 7));
+		}
+	} else {
+		for (; n > 0; n--, top += step, bot += step) {
+			tb = fb[top >> 1] >> ((top & 1) << 2);
+			bb = fb[bot >> 1] >> ((bot & 1) << 2);
+			CLOCK_CODE(HUB75_PAIR(tb & 7, bb & 7));
+		}
+	}
+}
+
+/* Color of pixel 'off' of a packed frame buffer */
+#define PACKED_CODE(fb, off)	(((fb)[(off) >> 1] >> (((off) & 1) << 2)) & 7)
+
+/* clock_pairs_pa() for a packed frame buffer, a pixel at a time */
+static void
+clock_packed_pa(const uint8_t *fb, const struct hub75_span *sp,
+				const struct hub75_span *sp_pa)
+{
+	int		top = sp->top, bot = sp->bot;
+	int		top_pa = sp_pa->top, bot_pa = sp_pa->bot;
+	int		n;
+
+	for (n = scan_width; n > 0; n--) {
+		GPIO_BSRR(GPIOB) = hub75_pair_bsrr[HUB75_PAIR(PACKED_CODE(fb, top),
+										PACKED_CODE(fb, bot))];
+		GPIO_BSRR(GPIOA) = hub75_pair_bsrr_pa[HUB75_PAIR(PACKED_CODE(fb, top_pa),
+										PACKED_CODE(fb, bot_pa))];
+		GPIO_BSRR(GPIOC) = HUB75_CLK;
+		GPIO_BSRR(GPIOC) = HUB75_CLK << 16;
+		top += sp->step;
+		bot += sp->step;
+		top_pa += sp_pa->step;
+		bot_pa += sp_pa->step;
+	}
+}
+
+/* hub75_scan_row() for a packed frame buffer */
+void
+hub75_scan_row_packed(const uint8_t *fb, int row)
+{
+	const struct hub75_span	*sp = &spans[row * scan_ports * scan_chain];
+	int		j;
+
+	hub75_set_row(row);
+	if (scan_ports > 1) {
+		for (j = 0; j < scan_chain; j++, sp++) {
+			clock_packed_pa(fb, sp, sp + scan_chain);
+		}
+		return;
+	}
+	for (j = 0; j < scan_chain; j++, sp++) {
+		clock_packed(fb, sp->top, sp->bot, scan_width, sp->step);
+	}
+}
+
+/*
+ * Panel 'j' of chain 'k', from the geometry or, if it has no panels,
+ * the frame buffer split into a band per chain (in '*tmp').
+ */
+static const struct hub75_panel *
+chain_panel(const struct hub75_geometry *g, int k, int j,
+			struct hub75_panel *tmp)
+{
+	if (g->panels) {
+		return &g->panels[k * g->chain + j];
+	}
+	tmp->x = j * g->panel_width;
+	tmp->y = k * g->panel_height;
+	tmp->flags = 0;
+	return tmp;
+}
+
+/* Frame buffer offset of pixel (x, y) of a panel */
+static int
+panel_offset(const struct hub75_geometry *g, const struct hub75_panel *pn,
+				int x, int y)
+{
+	int	t;
+
+	if (pn->flags & HUB75_FLIP_X) {
+		x = g->panel_width - 1 - x;
+	}
+	if (pn->flags & HUB75_FLIP_Y) {
+		y = g->panel_height - 1 - y;
+	}
+	if (pn->flags & HUB75_SWAP_XY) {
+		t = x; x = y; y = t;
+	}
+	return (pn->y + y) * g->width + pn->x + x;
+}
+
+/*
+ * Fill in spans[] for 'g' on 'ports' chains, and row_mask[], which
+ * scan rows read each frame buffer row. (tools/hub75_map_check.py
+ * builds this and the two above on the host to check the mapping.)
+ */
+static void
+build_spans(const struct hub75_geometry *g, int ports)
+{
+	const struct hub75_panel	*pn;
+	struct hub75_panel	tmp;
+	struct hub75_span	*sp;
+	int		row, j, k, w;
+
+	fb_swapped = 0;
+	for (row = 0; row < g->height; row++) {
+		row_mask[row] = 0;
+	}
+	for (row = 0, sp = spans; row < g->scan; row++) {
+		for (k = 0; k < ports; k++) {
+			/* the first pixels clocked in end up in the last panel */
+			for (j = g->chain - 1; j >= 0; j--, sp++) {
+				pn = chain_panel(g, k, j, &tmp);
+				fb_swapped |= pn->flags & HUB75_SWAP_XY;
+				sp->top = panel_offset(g, pn, 0, row);
+				sp->bot = panel_offset(g, pn, 0, row + g->scan);
+				sp->step = panel_offset(g, pn, 1, row) - sp->top;
+				/* which frame buffer rows this scan row reads */
+				for (w = 0; w < g->panel_width; w++) {
+					row_mask[(sp->top + w * sp->step) / g->width] |= 1U << row;
+					row_mask[(sp->bot + w * sp->step) / g->width] |= 1U << row;
+				}
+			}
+		}
+	}
+}
+
+/* Whether 'g' on 'ports' chains will work, see hub75_init() */
+static int
+check_geometry(const struct hub75_geometry *g, int ports)
+{
+	const struct hub75_panel	*pn;
+	struct hub75_panel	tmp;
+	int		j, w, h;
+
+	if ((g->scan != 8) && (g->scan != 16) && (g->scan != 32)) {
+		return -1;
+	}
+	if ((g->panel_height != 2 * g->scan) || (g->panel_width & 3) ||
+		(g->chain < 1) || (g->chain > HUB75_MAX_CHAIN) ||
+		(ports < 1) || (ports > HUB75_MAX_CHAINS) ||
+		(ports * g->scan * g->panel_width * g->chain > HUB75_MAX_SHIFT) ||
+		(g->width & 1) || (g->height > HUB75_MAX_HEIGHT) ||
+		(g->width * g->height > 65536)) {
+		return -1;
+	}
+	for (j = 0; j < ports * g->chain; j++) {
+		pn = chain_panel(g, j / g->chain, j % g->chain, &tmp);
+		w = (pn->flags & HUB75_SWAP_XY) ? g->panel_height : g->panel_width;
+		h = (pn->flags & HUB75_SWAP_XY) ? g->panel_width : g->panel_height;
+		if ((pn->x < 0) || (pn->y < 0) ||
+			(pn->x + w > g->width) || (pn->y + h > g->height)) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Size the scan for 'g' and build its tables. Nothing here touches
+ * the hardware, so tools/hub75_host.py can build it for the host.
+ */
+static void
+scan_tables(const struct hub75_geometry *g, int ports)
+{
+	int		row;
+
+	scan_rows = g->scan;
+	scan_chain = g->chain;
+	scan_ports = ports;
+	scan_width = g->panel_width;
+	scan_clocks = g->panel_width * g->chain;
+	plane_len = scan_clocks * ports;
+	fb_width = g->width;
+	fb_height = g->height;
+	for (row = 0; row < fb_height; row++) {
+		row_src[row] = 0;
+	}
+	build_spans(g, ports);
+}
+
+/* Deferred work, one row of the plain scan */
+static void
+scan_run(void)
+{
+	uint32_t	start;
+
+	start = dwt_read_cycle_counter();
+	scan_func();
+	scan_busy += dwt_read_cycle_counter() - start;
+}
+
+/* Time for the next row, the work is done at PendSV */
+void
+tim5_isr(void)
+{
+	if (timer_get_flag(TIM5, TIM_SR_UIF)) {
+		timer_clear_flag(TIM5, TIM_SR_UIF);
+		defer_work(scan_run);
+	}
+}
+
+/*
+ * Run the plain (one bit per color) scan: call 'func' to show the
+ * next row often enough to refresh the whole panel 'hz' times a
+ * second. TIM5 is a 32 bit timer on APB1 (84MHz), it has nothing to
+ * do with SysTick so mtime() is unaffected, and its interrupt is at
+ * the panel priority. Returns -1 if the rate is out of range.
+ */
+int
+hub75_scan_start(void (*func)(void), int hz)
+{
+	uint32_t	rate;
+
+	if ((scan_rows == 0) || (hz < 1)) {
+		return -1;
+	}
+	rate = (uint32_t) hz * scan_rows;
+	if (rate > HUB75_MAX_ROW_RATE) {
+		return -1;
+	}
+	hub75_scan_stop();
+	scan_func = func;
+	row_ticks = 84000000 / rate;
+	hub75_brightness(brightness);
+	rcc_periph_clock_enable(RCC_TIM5);
+	rcc_periph_reset_pulse(RST_TIM5);
+	timer_set_mode(TIM5, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+	timer_set_prescaler(TIM5, 0);
+	timer_set_period(TIM5, row_ticks - 1);
+	timer_enable_irq(TIM5, TIM_DIER_UIE);
+	nvic_set_priority(NVIC_TIM5_IRQ, IRQ_PRI_PANEL);
+	nvic_enable_irq(NVIC_TIM5_IRQ);
+	timer_enable_counter(TIM5);
+	return 0;
+}
+
+/*
+ * Stop the plain scan. A row already queued runs before we get back
+ * to thread mode, as PendSV preempts it.
+ */
+void
+hub75_scan_stop(void)
+{
+	if (scan_func == 0) {
+		return;
+	}
+	timer_disable_counter(TIM5);
+	nvic_disable_irq(NVIC_TIM5_IRQ);
+	timer_clear_flag(TIM5, TIM_SR_UIF);
+	scan_func = 0;
+}
+
+/*
+ * Plain scan, light the row just latched for the on time. The rest
+ * of the row period is left dark for addressing and clocking in the
+ * next row.
+ */
+void
+hub75_oe_pulse(void)
+{
+	if (row_on == 0) {
+		return;
+	}
+	TIM_ARR(TIM3) = row_on;
+	TIM_CCR2(TIM3) = 1;
+	TIM_CR1(TIM3) |= TIM_CR1_CEN;
+}
+
+/*
+ * Plain scan, wait until the row is dark before changing it. The
+ * pulse normally ended long ago, this only waits if the row work ran
+ * early.
+ */
+void
+hub75_oe_wait(void)
+{
+	while (TIM_CR1(TIM3) & TIM_CR1_CEN) ;
+}
+
+/*
+ * Set the global brightness, 0 (off) to HUB75_BRIGHTNESS_MAX. This
+ * only changes the OE pulse width so it costs nothing per row, and
+ * neither the refresh rate nor the BCM timing changes.
+ */
+void
+hub75_brightness(int level)
+{
+	uint32_t	guard;
+
+	if (level < 0) {
+		level = 0;
+	} else if (level > HUB75_BRIGHTNESS_MAX) {
+		level = HUB75_BRIGHTNESS_MAX;
+	}
+	brightness = level;
+	/* leave time in each row period for the row work */
+	guard = (row_ticks > 2 * HUB75_ROW_GUARD) ? HUB75_ROW_GUARD : row_ticks / 2;
+	row_on = ((row_ticks - guard) * brightness) / HUB75_BRIGHTNESS_MAX;
+}
+
+int
+hub75_get_brightness(void)
+{
+	return brightness;
+}
+
+/* CPU cycles spent in the plain scan since boot */
+uint32_t
+hub75_scan_cycles(void)
+{
+	return scan_busy;
+}
+
+/*
+ * Check the geometry (see hub75.h) and build the scan tables from it.
+ * 'frame' is called at each BCM frame boundary for the buffer to
+ * display. This also sets up TIM3, but doesn't take over the OE pin
+ * until hub75_bcm_start(). Returns -1 if the geometry won't work.
+ * If its rows are too long for DMA, the engine goes back to shifting
+ * them with the CPU.
+ */
+int
+hub75_init(const struct hub75_geometry *g, uint16_t *(*frame)(void))
+{
+	int		ports = (g->chains) ? g->chains : 1;
+
+	if (check_geometry(g, ports) < 0) {
+		return -1;
+	}
+
+	hub75_bcm_stop();
+	scan_tables(g, ports);
+	if (scan_clocks > HUB75_MAX_CLOCKS) {
+		/* dma_words only holds HUB75_MAX_CLOCKS a chain */
+		use_dma = 0;
+	}
+	scan_frame = frame;
+	if (ports > 1) {
+		rcc_periph_clock_enable(RCC_GPIOA);
+		gpio_mode_setup(GPIOA, GPIO_MODE_OUTPUT, GPIO_PUPD_PULLUP,
+						HUB75_PA_DATA_PINS);
+		gpio_clear(GPIOA, HUB75_PA_DATA_PINS);
+	}
+	hub75_reset_chain_stats();
+	/* it is in CCM, which isn't cleared at reset */
+	memset(dither_err, 0, sizeof(dither_err));
+	rehash = 1;
+	hub75_bcm_gamma(cur_gamma);
+
+	/*
+	 * TIM3 is on APB1 (84MHz timer clock). One pulse mode, PWM2
+	 * with inverted polarity on channel 2 means OE is high (off)
+	 * while stopped and low (on) from CNT == 1 until the update at
+	 * ARR, which also stops the counter and interrupts us. Moving
+	 * CCR2 up shortens the pulse without moving its end, which is
+	 * how brightness works.
+	 */
+	rcc_periph_clock_enable(RCC_TIM3);
+	rcc_periph_reset_pulse(RST_TIM3);
+	timer_set_mode(TIM3, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE, TIM_CR1_DIR_UP);
+	timer_set_prescaler(TIM3, 0);
+	timer_one_shot_mode(TIM3);
+	timer_disable_preload(TIM3);
+	timer_set_oc_mode(TIM3, TIM_OC2, TIM_OCM_PWM2);
+	timer_disable_oc_preload(TIM3, TIM_OC2);
+	timer_set_oc_polarity_low(TIM3, TIM_OC2);
+	timer_set_oc_value(TIM3, TIM_OC2, 1);
+	timer_set_period(TIM3, unit);
+	timer_enable_oc_output(TIM3, TIM_OC2);
+	timer_enable_irq(TIM3, TIM_DIER_UIE);
+	nvic_set_priority(NVIC_TIM3_IRQ, IRQ_PRI_PANEL);
+	nvic_enable_irq(NVIC_TIM3_IRQ);
+
+	/* OE belongs to TIM3 from now on, for both scans */
+	gpio_mode_setup(GPIOC, GPIO_MODE_AF, GPIO_PUPD_PULLUP, HUB75_OE);
+	gpio_set_af(GPIOC, GPIO_AF2, HUB75_OE);
+	return 0;
+}
+
+/*
+ * Start displaying with 'depth' bits per color channel, returns -1
+ * if the depth isn't supported, hub75_init() hasn't been called or
+ * DMA is on and the rows don't fit in its buffers.
+ */
+int
+hub75_bcm_start(int d)
+{
+	if ((d < HUB75_MIN_DEPTH) || (d > HUB75_MAX_DEPTH) || (scan_rows == 0) ||
+		(use_dma && (scan_clocks > HUB75_MAX_CLOCKS))) {
+		return -1;
+	}
+	hub75_bcm_stop();
+
+	depth = d;
+	shift_row = shift_bit = 0;
+	prep_row = prep_bit = 0;
+	cur_fb = 0;
+	rehash = 1;
+	anim = anim_next = NULL;
+	anim_change = 0;
+	anim_frame = -1;
+	waiting = WAIT_SHIFT;
+	stopped = 0;
+	running = 1;
+
+	if (use_dma) {
+		dma_setup();
+	}
+	defer_work(bcm_prime);
+	return 0;
+}
+
+/* Stop at the end of the current pulse */
+void
+hub75_bcm_stop(void)
+{
+	if (stopped) {
+		return;
+	}
+	running = 0;
+	while (! stopped) ;
+	depth = 0;
+	if (use_dma) {
+		gpio_clear(GPIOC, HUB75_CLK);
+		gpio_mode_setup(GPIOC, GPIO_MODE_OUTPUT, GPIO_PUPD_PULLUP, HUB75_CLK);
+	}
+}
+
+/*
+ * Shift rows out with DMA (on != 0) or with the CPU. Restarts the
+ * engine if it is running. Returns -1 if a row is too long for the
+ * TIM8 repetition counter.
+ */
+int
+hub75_bcm_dma(int on)
+{
+	int	d = depth;
+
+	if (on && (scan_clocks > HUB75_MAX_CLOCKS)) {
+		return -1;
+	}
+	hub75_bcm_stop();
+	use_dma = on;
+	if (d) {
+		hub75_bcm_start(d);
+	}
+	return 0;
+}
+
+/*
+ * Play animation 'a' at 'fps' frames a second (0 for its own rate)
+ * from the next frame boundary, round and round until it is stopped
+ * with NULL or the engine is restarted. Returns -1 if it wasn't made
+ * for this geometry and the depth the engine is running at.
+ */
+int
+hub75_bcm_play(const struct hub75_anim *a, int fps)
+{
+	uint32_t	mask, size;
+
+	if (a) {
+		size = a->rows * a->depth * a->clocks;
+		if ((depth == 0) || (a->rows != scan_rows) ||
+			(a->clocks != plane_len) || (a->depth != depth) ||
+			(a->frames == 0) || (a->data == NULL) ||
+			(((a->flags & HUB75_ANIM_DELTA) == 0) &&
+				(a->bytes < size * a->frames))) {
+			return -1;
+		}
+		if (fps <= 0) {
+			fps = (a->fps) ? a->fps : 1;
+		}
+	}
+	mask = cm_mask_interrupts(1);
+	anim_next = a;
+	anim_next_fps = fps;
+	anim_change = 1;
+	cm_mask_interrupts(mask);
+	return 0;
+}
+
+/* The animation frame on display, -1 if there isn't one */
+int
+hub75_bcm_anim_frame(void)
+{
+	return anim_frame;
+}
+
+/* Current depth, 0 if the engine isn't running */
+int
+hub75_bcm_depth(void)
+{
+	return depth;
+}
+
+/*
+ * Set the time of the least significant bit, in TIM3 ticks. The most
+ * significant bit (128 units) has to fit in 16 bits.
+ */
+void
+hub75_bcm_unit(int ticks)
+{
+	if ((ticks > 0) && ((ticks << (HUB75_MAX_DEPTH - 1)) <= 0xffff)) {
+		unit = ticks;
+	}
+}
+
+/*
+ * Set the gamma applied when the bit-planes are built, 1.0 is linear.
+ * The rows are re-encoded on the next frame.
+ */
+void
+hub75_bcm_gamma(float g)
+{
+	int	i;
+
+	cur_gamma = g;
+	for (i = 0; i < 32; i++) {
+		gamma5[i] = (uint16_t) (powf(i / 31.0f, g) *
+								((1 << GAMMA_BITS) - 1) + 0.5f);
+	}
+	for (i = 0; i < 64; i++) {
+		gamma6[i] = (uint16_t) (powf(i / 63.0f, g) *
+								((1 << GAMMA_BITS) - 1) + 0.5f);
+	}
+	rehash = 1;
+}
+
+float
+hub75_bcm_get_gamma(void)
+{
+	return cur_gamma;
+}
+
+/* Turn temporal dithering on (1) or off (0) */
+void
+hub75_bcm_dither(int on)
+{
+	dither = on;
+	rehash = 1;
+}
+
+/* Note that row 'y' of the frame buffer being drawn has changed */
+void
+hub75_dirty(int y)
+{
+	dirty_draw[y >> 5] |= 1U << (y & 31);
+}
+
+/*
+ * The frame in 'fb' is finished, it may now differ from what is
+ * on display in the rows marked since the last call.
+ */
+void
+hub75_dirty_done(const uint16_t *fb)
+{
+	struct dirty_buf	*db;
+	uint32_t	mask;
+	int			i;
+
+	mask = cm_mask_interrupts(1);
+	db = dirty_find(fb);
+	for (i = 0; i < DIRTY_WORDS; i++) {
+		if (db) {
+			db->diff[i] |= dirty_draw[i];
+		}
+		dirty_draw[i] = 0;
+	}
+	cm_mask_interrupts(mask);
+}
+
+/*
+ * With tracking on (1) only rows marked with hub75_dirty() are looked
+ * at when a new frame buffer is shown, off (0) they all are.
+ */
+void
+hub75_track_dirty(int on)
+{
+	uint32_t	mask;
+	int			i, j;
+
+	mask = cm_mask_interrupts(1);
+	for (j = 0; j < DIRTY_BUFS; j++) {
+		for (i = 0; i < DIRTY_WORDS; i++) {
+			dirty_bufs[j].diff[i] = ~0U;
+		}
+	}
+	track_dirty = on;
+	cm_mask_interrupts(mask);
+}
+
+/*
+ * The scanner calls this as each row is first lit, 'fb' is the frame
+ * buffer it is showing. Row 0 is the frame boundary.
+ */
+void
+hub75_scan_mark(int row, const uint16_t *fb)
+{
+	uint32_t	now, period, elapsed;
+	int			new_frame;
+
+	now = dwt_read_cycle_counter();
+	period = now - lit_last;
+	lit_last = now;
+	if (win_rows++ != 0) {
+		win_row_total += period;
+		if (period > win_row_max) {
+			win_row_max = period;
+		}
+	}
+	if (row != 0) {
+		return;
+	}
+
+	new_frame = (fb != lit_fb);
+	lit_fb = fb;
+	scan_stats.frames++;
+	win_frames++;
+	if (new_frame) {
+		scan_stats.swaps++;
+		win_swaps++;
+	}
+	if (frame_hook) {
+		frame_hook(fb, new_frame);
+	}
+
+	elapsed = now - win_start;
+	if (elapsed >= HUB75_CYCLES_PER_SEC) {
+		scan_stats.refresh_hz = (uint32_t) (((uint64_t) win_frames *
+									HUB75_CYCLES_PER_SEC) / elapsed);
+		scan_stats.swaps_hz = (uint32_t) (((uint64_t) win_swaps *
+									HUB75_CYCLES_PER_SEC) / elapsed);
+		scan_stats.row_max = win_row_max;
+		scan_stats.row_avg = (win_rows > 1) ?
+						(uint32_t) (win_row_total / (win_rows - 1)) : 0;
+		win_start = now;
+		win_frames = win_swaps = 0;
+		win_rows = 1;
+		win_row_max = 0;
+		win_row_total = 0;
+	}
+}
+
+/*
+ * Call 'hook' at every frame boundary (from the scanner's interrupt
+ * or deferred work, so keep it short), 'new_frame' is non-zero if
+ * 'fb' wasn't shown in the frame before.
+ */
+void
+hub75_frame_hook(void (*hook)(const uint16_t *fb, int new_frame))
+{
+	frame_hook = hook;
+}
+
+/* Copy out the refresh statistics, updated once a second */
+void
+hub75_get_scan_stats(struct hub75_scan_stats *s)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	*s = scan_stats;
+	cm_mask_interrupts(mask);
+}
+
+/*
+ * Copy out the encoding statistics. 'rows' out of (new_frames * scan
+ * rows) is the dirty ratio, cycles are 168 per uS.
+ */
+void
+hub75_get_encode_stats(struct hub75_encode_stats *s)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	*s = enc_stats;
+	cm_mask_interrupts(mask);
+}
+
+void
+hub75_reset_encode_stats(void)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	enc_stats.frames = enc_stats.new_frames = enc_stats.rows = 0;
+	enc_stats.cycles = enc_stats.cycles_max = 0;
+	cm_mask_interrupts(mask);
+}
+
+/* Count of frames displayed since boot */
+uint32_t
+hub75_bcm_frames(void)
+{
+	return frames;
+}
+
+/* CPU cycles spent shifting, preparing and encoding since boot */
+uint32_t
+hub75_bcm_cycles(void)
+{
+	return busy;
+}
+
+/* Shift timing since the last reset, see struct hub75_chain_stats */
+void
+hub75_get_chain_stats(struct hub75_chain_stats *s)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	*s = chain_stats;
+	cm_mask_interrupts(mask);
+	s->chains = scan_ports;
+	s->clocks = scan_clocks;
+}
+
+void
+hub75_reset_chain_stats(void)
+{
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	chain_stats.shifts = 0;
+	chain_stats.cycles = 0;
+	chain_stats.cycles_max = 0;
+	cm_mask_interrupts(mask);
+}
@@ -0,0 +1,298 @@
+/*
+ * hub75.h
+ *
+ * Definitions shared by the LED panel demos. The panels use the
+ * "HUB75" interface, two rows are driven at once (the top half on
+ * R1/G1/B1 and the bottom half on R2/G2/B2), the data is shifted in
+ * with CLK, transferred to the outputs with LAT, and the whole row
+ * is enabled with OE (active low).
+ */
+#ifndef __HUB75_H
+#define __HUB75_H
+
+/*
+ * ### Signals matching ###
+ *
+ *	PB0	- G2		PC9 - CLK
+ *	PB1 - G1		PC8 - LAT
+ *	PB10 - B2		PC7 - OE (TIM3_CH2)
+ *	PB11 - B1
+ *	PB12 - R2		PB5 - A
+ *	PB13 - R1		PB6 - B
+ *					PB7 - C
+ *					PB8 - D
+ *					PB9 - E
+ */
+#define HUB75_R1		GPIO13
+#define HUB75_G1		GPIO1
+#define HUB75_B1		GPIO11
+#define HUB75_R2		GPIO12
+#define HUB75_G2		GPIO0
+#define HUB75_B2		GPIO10
+#define HUB75_DATA_PINS	(HUB75_R1 | HUB75_G1 | HUB75_B1 | \
+						 HUB75_R2 | HUB75_G2 | HUB75_B2)
+#define HUB75_ROW_SHIFT	5
+#define HUB75_ROW_PINS	(0x1f << HUB75_ROW_SHIFT)
+
+#define HUB75_CLK		GPIO9
+#define HUB75_LAT		GPIO8
+#define HUB75_OE		GPIO7
+
+/*
+ * A second chain can be driven in parallel from its own data pins on
+ * GPIOA, sharing CLK, LAT, OE and the row address with the first, so a
+ * row of both goes in with the clocks of one. (The 64 pin package has
+ * no GPIOD, and PA2/PA3 are kept for USART2.)
+ *
+ *	PA0 - R1		PA5 - R2
+ *	PA1 - G1		PA6 - G2
+ *	PA4 - B1		PA7 - B2
+ */
+#define HUB75_PA_R1		GPIO0
+#define HUB75_PA_G1		GPIO1
+#define HUB75_PA_B1		GPIO4
+#define HUB75_PA_R2		GPIO5
+#define HUB75_PA_G2		GPIO6
+#define HUB75_PA_B2		GPIO7
+#define HUB75_PA_DATA_PINS	(HUB75_PA_R1 | HUB75_PA_G1 | HUB75_PA_B1 | \
+							 HUB75_PA_R2 | HUB75_PA_G2 | HUB75_PA_B2)
+
+/*
+ * Frame buffers are RGB565, which is what the gfx library hands
+ * to draw_pixel(). These are the eight colors the panels could
+ * show before there was a BCM engine.
+ */
+#define RGB565(r, g, b)	((uint16_t) ((((r) & 0xf8) << 8) | \
+						(((g) & 0xfc) << 3) | (((b) & 0xf8) >> 3)))
+#define LED_BLACK		0x0000
+#define LED_BLUE		0x001f
+#define LED_GREEN		0x07e0
+#define LED_CYAN		0x07ff
+#define LED_RED			0xf800
+#define LED_MAGENTA		0xf81f
+#define LED_YELLOW		0xffe0
+#define LED_WHITE		0xffff
+
+/* old style color number (bit 2 red, 1 green, 0 blue) to RGB565 */
+extern const uint16_t hub75_colors[8];
+
+/* and back again, using the most significant bit of each channel */
+#define RGB565_TO_3BIT(c)	((((c) >> 13) & 4) | (((c) >> 9) & 2) | \
+							 (((c) >> 4) & 1))
+
+/*
+ * One BSRR write sets all six data pins for a pixel pair, the index
+ * is the 3 bit color of the top pixel and of the bottom pixel.
+ */
+#define HUB75_PAIR(top, bot)	((top) | ((bot) << 3))
+extern const uint32_t hub75_pair_bsrr[64];
+extern const uint32_t hub75_pair_bsrr_pa[64];		/* the GPIOA chain */
+
+void hub75_clock_pairs(const uint16_t *top, const uint16_t *bot, int n, int step);
+void hub75_set_row(int row);
+
+/*
+ * Packed frame buffers, a nibble per pixel (bit 3 unused) holding the
+ * 3 bit color, for the plain scan. A quarter of the RGB565 size.
+ */
+#define HUB75_PACKED_BYTES(w, h)	(((w) * (h)) / 2)
+void hub75_packed_pixel(uint8_t *fb, int width, int x, int y, int c);
+void hub75_packed_span(uint8_t *fb, int width, int x, int y, int n, int c);
+
+/* The same for RGB565, to compare drawing into the two call for call */
+void hub75_rgb565_pixel(uint16_t *fb, int width, int x, int y, uint16_t c);
+void hub75_rgb565_span(uint16_t *fb, int width, int x, int y, int n, uint16_t c);
+
+/*
+ * Panel geometry
+ *
+ * The frame buffer is 'width' x 'height' pixels. It is shown on
+ * 'chain' panels of 'panel_width' x 'panel_height' with 'scan' row
+ * addresses (1/8, 1/16 or 1/32 scan, the panel is 2 * scan rows
+ * high). panels[0] is the one plugged into the board, panels[1] is
+ * plugged into that and so on. Each is placed with the frame buffer
+ * position of its top left corner (as it ends up) and flags which
+ * mirror it and/or swap its x and y, e.g. a panel mounted upside
+ * down is HUB75_ROT_180.
+ *
+ * With 'chains' of 2 there is a second chain of 'chain' panels on the
+ * GPIOA pins, panels[chain] onwards. If 'panels' is NULL the frame
+ * buffer is split between the chains, chain 0 across the top with its
+ * first panel on the left, chain 1 below it. 'chains' of 0 is 1.
+ */
+#define HUB75_FLIP_X	1
+#define HUB75_FLIP_Y	2
+#define HUB75_SWAP_XY	4
+#define HUB75_ROT_90	(HUB75_FLIP_Y | HUB75_SWAP_XY)
+#define HUB75_ROT_180	(HUB75_FLIP_X | HUB75_FLIP_Y)
+#define HUB75_ROT_270	(HUB75_FLIP_X | HUB75_SWAP_XY)
+
+#define HUB75_MAX_CHAIN	8
+#define HUB75_MAX_CHAINS	2		/* in parallel, GPIOB and GPIOA */
+#define HUB75_MAX_HEIGHT	256		/* frame buffer rows */
+
+struct hub75_panel {
+	int		x, y;
+	int		flags;
+};
+
+struct hub75_geometry {
+	int		width, height;
+	int		panel_width, panel_height;
+	int		scan;
+	int		chain;
+	const struct hub75_panel *panels;
+	int		chains;
+};
+
+int hub75_init(const struct hub75_geometry *g, uint16_t *(*frame)(void));
+void hub75_scan_row(const uint16_t *fb, int row);
+void hub75_scan_row_packed(const uint8_t *fb, int row);
+
+/* Plain scan, timed by TIM5 */
+#define HUB75_MAX_ROW_RATE	50000	/* rows per second, 20uS each */
+int hub75_scan_start(void (*func)(void), int hz);
+void hub75_scan_stop(void);
+uint32_t hub75_scan_cycles(void);
+
+/*
+ * OE is always driven by TIM3, the plain scan calls hub75_oe_wait()
+ * before changing rows and hub75_oe_pulse() after latching one.
+ * Brightness scales the on time of both scans.
+ */
+#define HUB75_BRIGHTNESS_MAX	255
+#define HUB75_ROW_GUARD		(84 * 16)	/* TIM3 ticks for the row work */
+void hub75_oe_pulse(void);
+void hub75_oe_wait(void);
+void hub75_brightness(int level);
+int hub75_get_brightness(void);
+
+/*
+ * Binary Code Modulation
+ *
+ * Each row is shown once per bit of color depth, bit 'n' for
+ * (1 << n) time units, with OE timed by TIM3 in one pulse mode. The
+ * bit-planes are built from the frame buffer a row at a time, just
+ * before the row is displayed, with gamma correction and optional
+ * temporal dithering.
+ *
+ * The panels are described by the geometry given to hub75_init(),
+ * whose frame function is called at each frame boundary and returns
+ * the buffer to display (this is where the double buffer swap
+ * happens).
+ */
+#define HUB75_MIN_DEPTH		1
+#define HUB75_MAX_DEPTH		8
+#define HUB75_MAX_SHIFT		4096	/* rows * clocks * chains, 4 64x32 panels */
+#define HUB75_DEFAULT_UNIT	84		/* TIM3 ticks (84MHz) in the LSB, 1uS */
+#define HUB75_DEFAULT_GAMMA	2.2f
+#define HUB75_MAX_CLOCKS	256		/* longest row DMA can shift */
+#define HUB75_DMA_PERIOD	24		/* TIM8 ticks (168MHz) per CLK, 7MHz */
+
+int hub75_bcm_start(int depth);
+void hub75_bcm_stop(void);
+int hub75_bcm_depth(void);
+void hub75_bcm_unit(int ticks);
+void hub75_bcm_gamma(float gamma);
+float hub75_bcm_get_gamma(void);
+void hub75_bcm_dither(int on);
+uint32_t hub75_bcm_frames(void);
+
+/*
+ * Prebaked animation
+ *
+ * Frames already in the engine's bit-plane layout (see hub75.c), for
+ * a given geometry and depth: for each scan row 'depth' planes of
+ * 'clocks' pixel pair codes, every chain's clocks. They are made on
+ * the host by tools/hub75_anim.py. While one plays the engine shifts
+ * its planes as they are, from flash or RAM, and encodes nothing.
+ *
+ * 'data' is either every frame whole, one after the other, or with
+ * HUB75_ANIM_DELTA the changes that take a black frame to the first,
+ * the first to the second and so on, then the last back to the first.
+ * Those are applied to the engine's own planes at the frame boundary.
+ * The changes for a frame are runs: a 16 bit count of bytes to skip
+ * and a 16 bit count of bytes that follow (both little endian), until
+ * one with a count of 0.
+ */
+#define HUB75_ANIM_DELTA	1
+
+struct hub75_anim {
+	uint16_t	rows;			/* scan rows */
+	uint16_t	clocks;			/* per plane, every chain's */
+	uint8_t		depth;
+	uint8_t		flags;
+	uint16_t	frames;
+	uint16_t	fps;			/* unless hub75_bcm_play() says otherwise */
+	uint32_t	bytes;			/* of 'data' */
+	const uint8_t *data;
+};
+
+int hub75_bcm_play(const struct hub75_anim *a, int fps);
+int hub75_bcm_anim_frame(void);
+
+/*
+ * Dirty rows, the demo calls hub75_dirty() for each frame buffer row
+ * it changes and hub75_dirty_done() when the frame is finished, so
+ * that the BCM engine only encodes what changed.
+ */
+struct hub75_encode_stats {
+	uint32_t	frames;			/* frames displayed */
+	uint32_t	new_frames;		/* of which showed a new frame buffer */
+	uint32_t	rows;			/* scan rows encoded */
+	uint32_t	cycles;			/* finding dirty rows and encoding them */
+	uint32_t	cycles_max;		/* the most in one frame */
+};
+
+void hub75_dirty(int y);
+void hub75_dirty_done(const uint16_t *fb);
+void hub75_track_dirty(int on);
+void hub75_get_encode_stats(struct hub75_encode_stats *s);
+void hub75_reset_encode_stats(void);
+
+/*
+ * A frame buffer row can be read from somewhere else, e.g. a row of a
+ * wider strip (ticker.c scrolls text that way without redrawing it).
+ */
+int hub75_row_source(int y, const uint16_t *src);
+
+/*
+ * Refresh statistics, whichever scan is running calls
+ * hub75_scan_mark() as it lights each row. They are recalculated once
+ * a second, times are in CPU cycles.
+ */
+#define HUB75_CYCLES_PER_SEC	168000000
+
+struct hub75_scan_stats {
+	uint32_t	refresh_hz;		/* frames per second */
+	uint32_t	swaps_hz;		/* new frame buffers shown per second */
+	uint32_t	row_avg;		/* time between rows being lit */
+	uint32_t	row_max;		/* the longest of them */
+	uint32_t	frames;			/* since boot */
+	uint32_t	swaps;
+};
+
+void hub75_scan_mark(int row, const uint16_t *fb);
+void hub75_frame_hook(void (*hook)(const uint16_t *fb, int new_frame));
+void hub75_get_scan_stats(struct hub75_scan_stats *s);
+uint32_t hub75_bcm_cycles(void);
+int hub75_bcm_dma(int on);
+
+/*
+ * Shift timing, the chains are clocked together so each plane takes
+ * the time of one chain's clocks whatever the number of chains. With
+ * the CPU it is the shift loop, with DMA from starting the transfer
+ * to its last word going out.
+ */
+struct hub75_chain_stats {
+	int			chains;			/* in parallel */
+	int			clocks;			/* per plane, each chain */
+	uint32_t	shifts;			/* planes shifted */
+	uint32_t	cycles;			/* total for those */
+	uint32_t	cycles_max;
+};
+
+void hub75_get_chain_stats(struct hub75_chain_stats *s);
+void hub75_reset_chain_stats(void);
+
+#endif /* generic header protector */
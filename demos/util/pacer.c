@@ -0,0 +1,133 @@
+/*
+ * pacer.c -- render on change, at a steady frame rate
+ *
+ * A demo loop that redraws as fast as it can mostly draws the same
+ * frame again. The pacer gives it slots at a target rate (worked out
+ * from mtime(), so they don't drift) and, at each slot, a hash of
+ * what the frame would show; the frame is only drawn if that changed.
+ *
+ * If drawing takes longer than a slot several frames running, the
+ * rate is halved (down to 1/PACER_MAX_DIV of the target) so frames
+ * come evenly rather than late, and it goes back up once they take
+ * well under the time there would be at the faster rate.
+ */
+
+#include <stdint.h>
+#include <libopencm3/cm3/dwt.h>
+#include "../util/util.h"
+
+#define PACER_OVERRUNS	3		/* slow frames in a row before slowing down */
+#define PACER_RECOVER	30		/* fast ones before speeding up again */
+#define CYCLES_PER_SEC	168000000U
+
+/* mtime() of slot 'slot' at the current rate */
+static uint32_t
+slot_time(const struct pacer *p, int slot)
+{
+	return p->base + ((uint32_t) slot * p->div * 1000) / p->fps;
+}
+
+/* Start again from 'now' with a slot every 'div' target frames */
+static void
+pacer_rate(struct pacer *p, uint32_t now, int div)
+{
+	p->div = div;
+	p->base = now;
+	p->slot = 0;
+	p->over = p->under = 0;
+}
+
+/* Aim for 'fps' frames a second, the next one is drawn whatever it shows */
+void
+pacer_init(struct pacer *p, int fps)
+{
+	p->fps = (fps < 1) ? 1 : (fps > 1000) ? 1000 : fps;
+	pacer_rate(p, mtime(), 1);
+	p->fresh = 1;
+	pacer_reset_stats(p);
+}
+
+/* The next frame is drawn even if its hash is the same */
+void
+pacer_force(struct pacer *p)
+{
+	p->fresh = 1;
+}
+
+/*
+ * Returns 1 if it is time for a frame, slots that went by while the
+ * loop was busy elsewhere are passed over.
+ */
+int
+pacer_due(struct pacer *p, uint32_t now)
+{
+	if ((int32_t) (now - slot_time(p, p->slot)) < 0) {
+		return 0;
+	}
+	do {
+		if (++p->slot == p->fps) {
+			/* a second's worth at this rate, move the base on */
+			p->base += p->div * 1000;
+			p->slot = 0;
+		}
+	} while ((int32_t) (now - slot_time(p, p->slot)) >= 0);
+	return 1;
+}
+
+/*
+ * At a slot, 'hash' stands for everything the frame would show.
+ * Returns 1 if it should be drawn (then call pacer_done() after), 0
+ * if it would be the same as the last one.
+ */
+int
+pacer_changed(struct pacer *p, uint32_t hash)
+{
+	if ((hash == p->hash) && ! p->fresh) {
+		p->skipped++;
+		return 0;
+	}
+	p->hash = hash;
+	p->fresh = 0;
+	p->start = dwt_read_cycle_counter();
+	return 1;
+}
+
+/* The frame is drawn, at mtime() 'now' */
+void
+pacer_done(struct pacer *p, uint32_t now)
+{
+	uint32_t	cycles, budget;
+
+	cycles = dwt_read_cycle_counter() - p->start;
+	budget = (CYCLES_PER_SEC / p->fps) * p->div;
+	p->rendered++;
+	p->cycles += cycles;
+	if (cycles > p->cycles_max) {
+		p->cycles_max = cycles;
+	}
+	/* still drawing when the next slot came round */
+	if ((int32_t) (now - slot_time(p, p->slot)) > 0) {
+		p->late++;
+	}
+	if (cycles > budget) {
+		p->under = 0;
+		if ((++p->over >= PACER_OVERRUNS) && (p->div < PACER_MAX_DIV)) {
+			pacer_rate(p, now, p->div * 2);
+			p->slowed++;
+		}
+	} else if (cycles < budget / 4) {
+		p->over = 0;
+		if ((++p->under >= PACER_RECOVER) && (p->div > 1)) {
+			pacer_rate(p, now, p->div / 2);
+		}
+	} else {
+		p->over = p->under = 0;
+	}
+}
+
+void
+pacer_reset_stats(struct pacer *p)
+{
+	p->rendered = p->skipped = p->late = p->slowed = 0;
+	p->cycles = p->cycles_max = 0;
+}
@@ -0,0 +1,2055 @@
+/*
+ * paneldemo.c -- the clock demo shared by leds and led2
+ *
+ * Everything the LED panel demos do but drive their own panels: the
+ * frame buffers, the clocks (drawn and QR), the benchmarks and the
+ * command loop. The demo's main.c gives it the geometry and the row
+ * scan for its panels, see paneldemo.h.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/gpio.h>
+#include <libopencm3/cm3/dwt.h>
+#include <gfx.h>
+#include <qrencode.h>
+#include "../util/time.h"
+#include "../util/util.h"
+#include "../util/hub75.h"
+#include "../util/qrfast.h"
+#include "../util/stream.h"
+#include "../util/ticker.h"
+#include "../util/wall.h"
+#include "../util/dial.h"
+#include "../util/fmath.h"
+#include "../util/paneldemo.h"
+
+
+/* ### prototypes ### */
+void gpio_init(void);
+void frame_done(void);
+void print_frame_stats(void);
+int set_depth(int depth, int refresh);
+void refresh_sweep(int refresh);
+void scan_sweep(int refresh);
+void print_defer_stats(void);
+void print_scan_cycles(void);
+void draw_ramps(void);
+void draw_pixel(int x, int y, uint16_t color);
+void clear_draw_buf(void);
+void print_encode_stats(void);
+void draw_clock(uint32_t time);
+void draw_face(int gmt);
+void copy_face(int gmt);
+void render_clock(uint32_t tm);
+void print_render_stats(void);
+void dial_bench(void);
+void math_bench(void);
+void play_spinner(int refresh);
+void paced_clock(void);
+void print_pacer_stats(void);
+void wall_pixel(int x, int y, uint16_t pix);
+void print_wall_stats(const struct wall_stats *st);
+void run_wall_master(int boards);
+void run_wall_board(int board);
+void print_qr_stats(void);
+void qr_pipe_flush(void);
+void qr_bench(void);
+void run_stream(void);
+void ticker_text(struct ticker *t, int font, int baseline, uint16_t fg,
+				 const char *text);
+void ticker_demo(void);
+void ticker_faster(void);
+void packed_pixel(int x, int y, uint16_t pix);
+uint32_t packed_scene(int n, int packed, int spans);
+void packed_report(void);
+void packed_demo(void);
+unsigned char *time_string(uint32_t t);
+
+/* The demo's panels, from panel_demo() */
+static const struct panel_demo *demo;
+
+
+/* ### code ### */
+
+/* set both portC pins and all of port B to output + pullup*/
+void
+gpio_init(void)
+{
+	rcc_periph_clock_enable(RCC_GPIOB);
+	gpio_mode_setup(GPIOB, GPIO_MODE_OUTPUT, GPIO_PUPD_PULLUP, 0xffff);
+	gpio_clear(GPIOB, 0xffff);
+	rcc_periph_clock_enable(RCC_GPIOC);
+	gpio_mode_setup(GPIOC, GPIO_MODE_OUTPUT, GPIO_PUPD_PULLUP, GPIO9 | GPIO8 | GPIO7);
+	gpio_mode_setup(GPIOC, GPIO_MODE_OUTPUT, GPIO_PUPD_NONE, GPIO2);
+	gpio_clear(GPIOC, GPIO2 | GPIO9 | GPIO8 | GPIO7);
+}
+
+uint16_t buf1[DISPWIDTH * DISPHEIGHT];
+uint16_t buf2[DISPWIDTH * DISPHEIGHT];
+uint16_t buf3[DISPWIDTH * DISPHEIGHT];
+uint16_t *draw_buf;
+uint16_t *display_buf;
+struct tribuf frames;
+
+/* The clock face without its hands, see copy_face() */
+uint16_t face_buf[DISPWIDTH * DISPHEIGHT];
+
+
+void
+draw_pixel(int x, int y, uint16_t color)
+{
+	uint16_t *p = draw_buf + y * DISPWIDTH + x;
+
+	/* let the BCM engine know which rows need encoding again */
+	if (*p != color) {
+		*p = color;
+		if (draw_buf != face_buf) {
+			hub75_dirty(y);
+		}
+	}
+}
+
+/* Clear the draw buffer to black, marking the rows that change */
+void
+clear_draw_buf(void)
+{
+	uint32_t	*p = (uint32_t *) draw_buf;
+	int			x, y, changed;
+
+	for (y = 0; y < DISPHEIGHT; y++) {
+		changed = 0;
+		for (x = 0; x < DISPWIDTH / 2; x++, p++) {
+			if (*p != 0) {
+				*p = 0;
+				changed = 1;
+			}
+		}
+		if (changed) {
+			hub75_dirty(y);
+		}
+	}
+}
+
+/*
+ * Called at the start of each frame, picks up the newest frame that
+ * has been drawn. Returns the buffer to display.
+ */
+uint16_t *
+swap_buffers(void)
+{
+	display_buf = tribuf_latest(&frames);
+	ticker_update(mtime());
+	return display_buf;
+}
+
+/*
+ * The frame in draw_buf is complete, hand it to the display and
+ * carry on drawing in another buffer straight away.
+ */
+void
+frame_done(void)
+{
+	hub75_dirty_done(draw_buf);
+	draw_buf = tribuf_publish(&frames);
+}
+
+/*
+ * Which way the plain row scan clocks out pixels: the original
+ * set_pin() path or one BSRR write per pixel pair from the table in
+ * hub75.c (the default). 'scan_cycles' is what it took, from DWT.
+ */
+int lut_scan = 1;
+uint32_t scan_cycles;
+uint32_t scan_count;
+
+/*
+ * A packed (nibble per pixel) frame buffer. Four panels of it take as
+ * much as one of RGB565, so it borrows face_buf (see packed_demo()).
+ * With 'packed_show' the table path scans it instead of display_buf.
+ */
+uint8_t *const packed_buf = (uint8_t *) face_buf;
+int packed_show = 0;
+
+/* Report the average cycles per scan row for the current path, and reset */
+void
+print_scan_cycles(void)
+{
+	uint32_t	cycles, count;
+
+	cycles = scan_cycles;
+	count = scan_count;
+	scan_cycles = scan_count = 0;
+	printf("%s path: %d cycles per scan row (%d rows)\n",
+				(packed_show) ? "Packed" : (lut_scan) ? "Table" : "set_pin()",
+				(int) ((count) ? cycles / count : 0), (int) count);
+}
+
+/*
+ * Run the original row scan at a range of refresh rates and report
+ * what it actually achieves and how much of the CPU it takes.
+ */
+void
+scan_sweep(int refresh)
+{
+	static const int rates[] = { 60, 120, 240, 480, 960, 1920 };
+	struct hub75_scan_stats ss;
+	uint32_t	count, cycles;
+	int			i, old_depth;
+
+	old_depth = hub75_bcm_depth();
+	for (i = 0; i < (int) (sizeof(rates) / sizeof(rates[0])); i++) {
+		if (set_depth(0, rates[i]) < 0) {
+			printf("  %d Hz: too fast\n", rates[i]);
+			continue;
+		}
+		msleep(100);
+		hub75_get_scan_stats(&ss);
+		count = ss.frames;
+		cycles = hub75_scan_cycles();
+		msleep(1000);
+		cycles = hub75_scan_cycles() - cycles;
+		hub75_get_scan_stats(&ss);
+		printf("  %d Hz: %d Hz, CPU %d.%d%%\n", rates[i],
+					(int) (ss.frames - count),
+					(int) (cycles / 1680000),
+					(int) ((cycles / 168000) % 10));
+	}
+	set_depth(old_depth, refresh);
+}
+
+/* Show how long the row work waits in the queue */
+void
+print_defer_stats(void)
+{
+	struct defer_stats ds;
+
+	defer_get_stats(&ds);
+	printf("Deferred work: %d queued, %d run, %d dropped, max depth %d\n",
+		(int) ds.posted, (int) ds.run, (int) ds.dropped, (int) ds.depth_max);
+	printf("    latency (uS): min %d.%02d, avg %d.%02d, max %d.%02d\n",
+		(int) (ds.lat_min / 168), (int) ((ds.lat_min % 168) * 100 / 168),
+		(int) (ds.lat_avg / 168), (int) ((ds.lat_avg % 168) * 100 / 168),
+		(int) (ds.lat_max / 168), (int) ((ds.lat_max % 168) * 100 / 168));
+	defer_reset_stats();
+}
+
+/*
+ * Switch between the original row scan (depth 0), refreshing the
+ * panel 'refresh' times a second, and the BCM engine with 'depth'
+ * bits per color.
+ */
+int
+set_depth(int depth, int refresh)
+{
+	if (depth == 0) {
+		hub75_bcm_stop();
+		return hub75_scan_start(demo->scan, refresh);
+	}
+	hub75_scan_stop();
+	if (hub75_bcm_start(depth) < 0) {
+		hub75_scan_start(demo->scan, refresh);
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * Report the refresh rate the BCM engine achieves at each depth, and
+ * how long each plane takes to shift into the chains.
+ */
+void
+refresh_sweep(int refresh)
+{
+	struct hub75_chain_stats	cs;
+	int			depth, old_depth;
+	uint32_t	start, cycles;
+
+	old_depth = hub75_bcm_depth();
+	for (depth = 4; depth <= HUB75_MAX_DEPTH; depth++) {
+		set_depth(depth, refresh);
+		msleep(100);
+		start = hub75_bcm_frames();
+		cycles = hub75_bcm_cycles();
+		hub75_reset_chain_stats();
+		msleep(1000);
+		cycles = hub75_bcm_cycles() - cycles;
+		hub75_get_chain_stats(&cs);
+		/* 168M cycles in the second, so 1.68M per percent */
+		printf("  %d bits per color: %d Hz, CPU %d.%d%%\n", depth,
+					(int) (hub75_bcm_frames() - start),
+					(int) (cycles / 1680000),
+					(int) ((cycles / 168000) % 10));
+		printf("    %d chain%s of %d clocks: %d cycles per plane, max %d\n",
+					cs.chains, (cs.chains > 1) ? "s" : "", cs.clocks,
+					(int) ((cs.shifts) ? cs.cycles / cs.shifts : 0),
+					(int) cs.cycles_max);
+	}
+	set_depth(old_depth, refresh);
+}
+
+int gmt_clock;
+int flip_it = 0;
+void draw_24hr_clock(uint32_t tm);
+
+/*
+ * The static part of the clock face, the outer circle, the numbers
+ * and the tick marks. 'gmt' selects the 24 hour face.
+ */
+static const struct {
+	int				x[2], y;		/* 12 hour, 24 hour */
+	const char		*label[2];
+} face_labels[4] = {
+	{ { 26, 26 }, 11, { "12", "24" } },
+	{ { 54, 54 }, 36, { "3", "6" } },
+	{ { 30, 26 }, 60, { "6", "12" } },
+	{ { 4, 4 }, 36, { "9", "18" } },
+};
+
+/*
+ * With 'table_dial' on, the face and hands come out of the tables in
+ * ../util/dial.c rather than being worked out (in single precision,
+ * see ../util/fmath.c), 'a' compares the two.
+ */
+int table_dial = 1;
+
+void
+draw_face(int gmt)
+{
+	const struct dial_point	*p;
+	int x0, x1, y0, y1;
+	int i;
+
+	/* Draw the outer circle */
+#ifdef GFX_CIRCLE
+	gfx_drawCircle(32,32,31, LED_GREEN);
+#else
+#define CIRCLE_INC	5
+	if (table_dial) {
+		for (i = 0, p = dial_rim; i < DIAL_RIM; i++, p++) {
+			gfx_drawLine(p[0].x, p[0].y, p[1].x, p[1].y, LED_GREEN);
+		}
+	} else {
+		for (i = 0; i < 360; i += CIRCLE_INC) {
+			x0 = 32.5f + 31.0f * fm_sinf((float) i / 180.0f * FM_PI);
+			y0 = 32.5f + 31.0f * fm_cosf((float) i / 180.0f * FM_PI);
+			x1 = 32.5f + 31.0f * fm_sinf((float) (i + CIRCLE_INC) / 180.0f * FM_PI);
+			y1 = 32.5f + 31.0f * fm_cosf((float) (i + CIRCLE_INC) / 180.0f * FM_PI);
+			gfx_drawLine(x0, y0, x1, y1, LED_GREEN);
+		}
+	}
+#endif
+
+	/* small font add numbers. */
+	gfx_setFont(GFX_FONT_SMALL);
+	gfx_setTextColor(LED_RED, LED_BLACK);
+	for (i = 0; i < 4; i++) {
+		gfx_setCursor(face_labels[i].x[gmt], face_labels[i].y);
+		gfx_puts((unsigned char *) face_labels[i].label[gmt]);
+	}
+
+	/* add the tick marks, long ones at 5 minute and short ones minute */
+	for (i = 1; i < 60; i++) {
+
+		if ((i == 0) || (i == 15) || (i == 30) || (i == 45)) {
+			continue;
+		}
+		if (table_dial) {
+			p = dial_tick[i];
+			if ((i % 5) == 0) {
+				gfx_drawLine(p[1].x, p[1].y, p[0].x, p[0].y, LED_BLUE);
+			} else {
+				gfx_drawPixel(p[0].x, p[0].y, LED_BLUE);
+			}
+			continue;
+		}
+		x1 = (int) (32.5f + 30.0f * fm_sinf((float) i / 30.0f * FM_PI));
+		y1 = (int) (32.5f + 30.0f * fm_cosf((float) i / 30.0f * FM_PI));
+		if ((i % 5) == 0) {
+			x0 = (int) (32.5f + 25.0f * fm_sinf((float) i / 30.0f * FM_PI));
+			y0 = (int) (32.5f + 25.0f * fm_cosf((float) i / 30.0f * FM_PI));
+			gfx_drawLine(x0, y0, x1, y1, LED_BLUE);
+		} else {
+			gfx_drawPixel(x1, y1, LED_BLUE);
+		}
+	}
+}
+
+/*
+ * Start a clock frame with the face already drawn. The face only
+ * changes with the 12/24 hour mode and the mirroring, so it is drawn
+ * once into face_buf and copied in for each frame, marking the rows
+ * that differ. With 'cached_face' off it is drawn from scratch every
+ * time, like it used to be, to compare the two with 'F', and while
+ * face_buf is lent to the tickers or the packed frame buffer
+ * ('face_lent').
+ */
+int cached_face = 1;
+int face_lent;
+static int face_key = -1;
+
+void
+copy_face(int gmt)
+{
+	uint32_t	*src, *dst;
+	uint16_t	*save;
+	int			x, y, changed, key;
+
+	if (! cached_face || face_lent) {
+		clear_draw_buf();
+		draw_face(gmt);
+		return;
+	}
+
+	key = gmt | (flip_it << 1);
+	if (key != face_key) {
+		save = draw_buf;
+		draw_buf = face_buf;
+		memset(face_buf, 0, sizeof(face_buf));
+		draw_face(gmt);
+		draw_buf = save;
+		face_key = key;
+	}
+
+	src = (uint32_t *) face_buf;
+	dst = (uint32_t *) draw_buf;
+	for (y = 0; y < DISPHEIGHT; y++) {
+		changed = 0;
+		for (x = 0; x < DISPWIDTH / 2; x++, src++, dst++) {
+			if (*dst != *src) {
+				*dst = *src;
+				changed = 1;
+			}
+		}
+		if (changed) {
+			hub75_dirty(y);
+		}
+	}
+}
+
+/*
+ * Where the hands of either face end at time 'tm', in the order they
+ * are drawn. They are kept for the last time asked about, so working
+ * out whether the frame changed and then drawing it only does the
+ * trig once.
+ */
+#define CLOCK_HANDS	4
+
+struct clock_hand {
+	int			x, y;
+	uint16_t	color;
+};
+
+static struct clock_hand hands[CLOCK_HANDS];
+static uint32_t hands_tm;
+static int hands_gmt = -1;
+
+#define HAND(i, len, a, c)	\
+	hands[i].x = 32 + (len) * fm_sinf(a); \
+	hands[i].y = 32 - (len) * fm_cosf(a); \
+	hands[i].color = (c)
+
+#define HAND_AT(i, p, c)	\
+	hands[i].x = (p).x; \
+	hands[i].y = (p).y; \
+	hands[i].color = (c)
+
+static const struct clock_hand *
+clock_hands(uint32_t tm, int gmt)
+{
+	simple_time *t; 
+	int hh, mm, ss, ms;
+
+	if ((tm == hands_tm) && (gmt == hands_gmt)) {
+		return hands;
+	}
+	hands_tm = tm;
+	hands_gmt = gmt;
+	t = time_get(tm);
+	
+	hh = t->hh;
+	mm = t->mm;
+	ss = t->ss;
+	ms = t->ms;
+
+	if (table_dial && gmt) {
+		HAND_AT(0, dial_sec[ss * 60], LED_MAGENTA);
+		HAND_AT(1, dial_min[mm * 60], LED_GREEN);
+		HAND_AT(2, dial_hour[hh * 60 + mm], LED_CYAN);
+		HAND_AT(3, dial_ms[ms], LED_BLUE);
+		return hands;
+	}
+	if (table_dial) {
+		HAND_AT(0, dial_ms[ms], LED_BLUE);
+#ifdef CONTINUOUS_SECONDS
+		HAND_AT(1, dial_sec[ss * 60 + ms * 3 / 50], LED_MAGENTA);
+#else
+		HAND_AT(1, dial_sec[ss * 60], LED_MAGENTA);
+#endif
+		HAND_AT(2, dial_min[mm * 60 + ss], LED_GREEN);
+		HAND_AT(3, dial_hour[((hh % 12) * 60 + mm) * 2], LED_CYAN);
+		return hands;
+	}
+	if (gmt) {
+		HAND(0, 25, (float) ss/30.0f * FM_PI, LED_MAGENTA);
+		HAND(1, 20, (float) mm/30.0f * FM_PI, LED_GREEN);
+		HAND(2, 15, ((float) hh + (float) mm / 60.0f) / 12.0f * FM_PI, LED_CYAN);
+		HAND(3, 10, (float) ms/500.0f * FM_PI, LED_BLUE);
+		return hands;
+	}
+	/* Bottom: MS hand
+	 *		   Second hand
+	 *		   Minute hand
+	 *		   Hour hand
+	 */
+	HAND(0, 10, (float) ms/500.0f * FM_PI, LED_BLUE);
+#ifdef CONTINUOUS_SECONDS
+	HAND(1, 25, (float) (ss + (ms / 1000.0f)) / 30.0f * FM_PI, LED_MAGENTA);
+#else
+	HAND(1, 25, (float) ss / 30.0f * FM_PI, LED_MAGENTA);
+#endif
+	HAND(2, 20, (float) (mm + (ss / 60.0f)) / 30.0f * FM_PI, LED_GREEN);
+	HAND(3, 15, ((float) hh + (float) mm / 60.0f) / 6.0f * FM_PI, LED_CYAN);
+	return hands;
+}
+
+/* Start point is always the center of the circle (32, 32) */
+static void
+draw_hands(const struct clock_hand *h)
+{
+	int		i;
+
+	for (i = 0; i < CLOCK_HANDS; i++) {
+		gfx_drawLine(32, 32, h[i].x, h[i].y, h[i].color);
+	}
+	gfx_fillCircle(32,32,3, LED_YELLOW);
+}
+
+/*
+ * Hash of everything a clock frame shows, the face and where the hands
+ * are, for the frame pacer. Most milliseconds move nothing.
+ */
+static uint32_t
+clock_hash(uint32_t tm)
+{
+	const struct clock_hand	*h = clock_hands(tm, gmt_clock);
+	uint32_t	hash = 2166136261U;
+	int			i;
+
+	hash = (hash ^ (gmt_clock | (flip_it << 1))) * 16777619U;
+	for (i = 0; i < CLOCK_HANDS; i++) {
+		hash = (hash ^ (h[i].x & 0xff) ^ ((h[i].y & 0xff) << 8)) * 16777619U;
+	}
+	return hash;
+}
+
+void
+draw_24hr_clock(uint32_t tm)
+{
+	copy_face(1);
+
+	/* rotate hands */
+	draw_hands(clock_hands(tm, 1));
+	frame_done();
+}
+
+/*
+ * Construct the elements of a clock
+ *
+ * This includes the face, annotations, hour, minute, second and
+ * millesecond hands.
+ */
+void
+draw_clock(uint32_t tm)
+{
+	/* the face, on an otherwise black buffer */
+	copy_face(0);
+
+	/* Draw hands, bottom to top */
+	draw_hands(clock_hands(tm, 0));
+	frame_done();
+}
+
+/*
+ * Draw one frame of whichever clock is showing, keeping track of how
+ * long it takes (DWT cycles, including handing the frame over).
+ */
+static uint32_t render_cycles;
+static uint32_t render_max;
+static uint32_t render_count;
+
+void
+render_clock(uint32_t tm)
+{
+	uint32_t	start, cycles;
+
+	start = dwt_read_cycle_counter();
+	if (gmt_clock) {
+		draw_24hr_clock(tm);
+	} else {
+		draw_clock(tm);
+	}
+	cycles = dwt_read_cycle_counter() - start;
+	render_cycles += cycles;
+	if (cycles > render_max) {
+		render_max = cycles;
+	}
+	render_count++;
+}
+
+/*
+ * Time working out the hands, and drawing a whole clock frame with the
+ * face redrawn too, at the same DIAL_BENCH times with fm_sinf() and
+ * fm_cosf() and from the tables, and count the hands that don't end in
+ * the same place.
+ */
+#define DIAL_BENCH	500
+
+void
+dial_bench(void)
+{
+	struct clock_hand	trig[CLOCK_HANDS];
+	uint32_t	start, hand_cycles[2], frame_cycles[2], tm;
+	int			save_dial = table_dial, save_face = cached_face;
+	int			i, j, mode, differ = 0;
+
+	cached_face = 0;
+	for (mode = 0; mode < 2; mode++) {
+		table_dial = mode;
+		hand_cycles[mode] = frame_cycles[mode] = 0;
+		for (i = 0; i < DIAL_BENCH; i++) {
+			/* 12 and 24 hour faces, and times all round the dial */
+			tm = (uint32_t) i * 172821;
+			start = dwt_read_cycle_counter();
+			clock_hands(tm, i & 1);
+			hand_cycles[mode] += dwt_read_cycle_counter() - start;
+			if (mode == 0) {
+				memcpy(trig, hands, sizeof(trig));
+				hands_gmt = -1;
+				table_dial = 1;
+				clock_hands(tm, i & 1);		/* the tables, to compare */
+				table_dial = 0;
+				for (j = 0; j < CLOCK_HANDS; j++) {
+					if ((hands[j].x != trig[j].x) || (hands[j].y != trig[j].y)) {
+						differ++;
+					}
+				}
+			}
+			hands_gmt = -1;
+			start = dwt_read_cycle_counter();
+			if (i & 1) {
+				draw_24hr_clock(tm);
+			} else {
+				draw_clock(tm);
+			}
+			frame_cycles[mode] += dwt_read_cycle_counter() - start;
+			hands_gmt = -1;
+		}
+	}
+	table_dial = save_dial;
+	cached_face = save_face;
+	face_key = -1;
+	printf("\n%d frames, cycles each    sinf/cosf  tables\n", DIAL_BENCH);
+	printf("  hands                %8d  %8d\n",
+		(int) (hand_cycles[0] / DIAL_BENCH), (int) (hand_cycles[1] / DIAL_BENCH));
+	printf("  frame, face redrawn  %8d  %8d\n",
+		(int) (frame_cycles[0] / DIAL_BENCH), (int) (frame_cycles[1] / DIAL_BENCH));
+	printf("%d of %d hands end on a different pixel\n", differ,
+		DIAL_BENCH * CLOCK_HANDS);
+}
+
+/*
+ * Cycles per call of libm's double and float functions next to the
+ * ones in ../util/fmath.c, over MATH_BENCH arguments, and the largest
+ * error of each against the double one (in 1e-9, of the result for
+ * sin and atan2, relative for the square roots).
+ */
+#define MATH_BENCH	1000
+#define MATH_WAYS	4
+
+static volatile float math_sink;
+static volatile int32_t math_isink;
+
+#define MATH_TIME(way, expr)	\
+	start = dwt_read_cycle_counter(); \
+	for (i = 0; i < MATH_BENCH; i++) { \
+		expr; \
+	} \
+	cycles[way] = dwt_read_cycle_counter() - start
+
+/* keep the biggest error 'e', in 1e-9 */
+#define MATH_ERR(way, e)	\
+	err = (e) * 1e9; \
+	if (err < 0) { \
+		err = -err; \
+	} \
+	if (err > worst[way]) { \
+		worst[way] = err; \
+	}
+
+static void
+math_row(const char *name, const uint32_t *cycles, const double *worst)
+{
+	int		i;
+
+	printf("%-6s", name);
+	for (i = 0; i < MATH_WAYS; i++) {
+		printf(" %8d", (int) (cycles[i] / MATH_BENCH));
+	}
+	for (i = 0; i < MATH_WAYS; i++) {
+		printf(" %8d", (int) worst[i]);
+	}
+	printf("\n");
+}
+
+/* argument 'i' of the MATH_BENCH, -8 to 8 and as a binary angle */
+#define MATH_X(i)	((float) ((i) - MATH_BENCH / 2) * (16.0f / MATH_BENCH))
+#define MATH_A(i)	((uint16_t) (((i) - MATH_BENCH / 2) * (int) (16.0f / MATH_BENCH * FM_TURN / (2 * FM_PI))))
+
+void
+math_bench(void)
+{
+	uint32_t	start, cycles[MATH_WAYS];
+	double		worst[MATH_WAYS], err, ref;
+	float		x, y;
+	int			i;
+
+	printf("\n%-6s %8s %8s %8s %8s  max error (1e-9)\n", "cycles", "double",
+		"float", "fmath", "fixed");
+
+	MATH_TIME(0, math_sink = sin(MATH_X(i)));
+	MATH_TIME(1, math_sink = sinf(MATH_X(i)));
+	MATH_TIME(2, math_sink = fm_sinf(MATH_X(i)));
+	MATH_TIME(3, math_isink = fm_sin_q15(MATH_A(i)));
+	memset(worst, 0, sizeof(worst));
+	for (i = 0; i < MATH_BENCH; i++) {
+		ref = sin(MATH_X(i));
+		MATH_ERR(1, sinf(MATH_X(i)) - ref);
+		MATH_ERR(2, fm_sinf(MATH_X(i)) - ref);
+		MATH_ERR(3, fm_sin_q15(MATH_A(i)) / (double) FM_Q15_ONE -
+						sin(MATH_A(i) * (2 * M_PI / FM_TURN)));
+	}
+	math_row("sin", cycles, worst);
+
+	MATH_TIME(0, math_sink = atan2(MATH_X(i), MATH_X(MATH_BENCH - 1 - i) + 0.3f));
+	MATH_TIME(1, math_sink = atan2f(MATH_X(i), MATH_X(MATH_BENCH - 1 - i) + 0.3f));
+	MATH_TIME(2, math_sink = fm_atan2f(MATH_X(i), MATH_X(MATH_BENCH - 1 - i) + 0.3f));
+	MATH_TIME(3, math_isink = fm_atan2_q15(FM_Q16(MATH_X(i)),
+				FM_Q16(MATH_X(MATH_BENCH - 1 - i) + 0.3f)));
+	memset(worst, 0, sizeof(worst));
+	for (i = 0; i < MATH_BENCH; i++) {
+		x = MATH_X(MATH_BENCH - 1 - i) + 0.3f;
+		y = MATH_X(i);
+		ref = atan2(y, x);
+		MATH_ERR(1, atan2f(y, x) - ref);
+		MATH_ERR(2, fm_atan2f(y, x) - ref);
+		/* a binary angle, compared the short way round */
+		err = fm_atan2_q15(FM_Q16(y), FM_Q16(x)) * (2 * M_PI / FM_TURN) - ref;
+		if (err > M_PI) {
+			err -= 2 * M_PI;
+		}
+		MATH_ERR(3, err);
+	}
+	math_row("atan2", cycles, worst);
+
+	MATH_TIME(0, math_sink = sqrt(i * 7.3f));
+	MATH_TIME(1, math_sink = sqrtf(i * 7.3f));
+	MATH_TIME(2, math_sink = fm_sqrtf(i * 7.3f));
+	MATH_TIME(3, math_isink = fm_sqrt_q16(FM_Q16(i * 7.3f)));
+	memset(worst, 0, sizeof(worst));
+	for (i = 1; i < MATH_BENCH; i++) {
+		ref = sqrt(i * 7.3f);
+		MATH_ERR(1, sqrtf(i * 7.3f) / ref - 1);
+		MATH_ERR(2, fm_sqrtf(i * 7.3f) / ref - 1);
+		ref = sqrt(FM_Q16(i * 7.3f) / 65536.0);
+		MATH_ERR(3, fm_sqrt_q16(FM_Q16(i * 7.3f)) / 65536.0 / ref - 1);
+	}
+	math_row("sqrt", cycles, worst);
+}
+
+extern const struct hub75_anim spinner;		/* the demo's spinner.c */
+
+/*
+ * Start or stop the spinner, baked by tools/hub75_anim.py for this
+ * geometry. While it plays the BCM engine shifts its planes as they
+ * are, so the clock goes on drawing but nothing is encoded, and the
+ * only cost is copying in each frame's changes.
+ */
+void
+play_spinner(int refresh)
+{
+	struct hub75_encode_stats es;
+
+	if (hub75_bcm_anim_frame() >= 0) {
+		hub75_bcm_play(NULL, 0);
+		hub75_get_encode_stats(&es);
+		printf("Spinner stopped: %d frames, %d cycles a frame, worst %d\n",
+			(int) es.frames, (int) ((es.frames) ? es.cycles / es.frames : 0),
+			(int) es.cycles_max);
+		return;
+	}
+	if ((hub75_bcm_depth() != spinner.depth) &&
+		(set_depth(spinner.depth, refresh) < 0)) {
+		printf("Can't do %d bits per color\n", spinner.depth);
+		return;
+	}
+	hub75_reset_encode_stats();
+	if (hub75_bcm_play(&spinner, 0) < 0) {
+		printf("The spinner isn't for this geometry\n");
+		return;
+	}
+	printf("Spinner: %d frames at %d fps, %d bits per color, %d bytes\n",
+		spinner.frames, spinner.fps, spinner.depth, (int) spinner.bytes);
+}
+
+/* Report (and reset) the clock render time with the current face mode */
+void
+print_render_stats(void)
+{
+	uint32_t	avg;
+
+	avg = (render_count) ? render_cycles / render_count : 0;
+	printf("%s face: %d frames, render (uS) avg %d.%02d, max %d.%02d\n",
+		(cached_face) ? "Cached" : "Redrawn", (int) render_count,
+		(int) (avg / 168), (int) ((avg % 168) * 100 / 168),
+		(int) (render_max / 168), (int) ((render_max % 168) * 100 / 168));
+	render_cycles = render_max = render_count = 0;
+}
+
+/*
+ * The clock is drawn at 'clock_pacer' slots, and only when a hand has
+ * moved a pixel (or a key was pressed), unless 'pace_frames' is off
+ * and it is drawn as often as the loop comes round.
+ */
+struct pacer clock_pacer;
+int pace_frames = 1;
+
+void
+paced_clock(void)
+{
+	uint32_t	tm = mtime();
+
+	if (! pace_frames) {
+		render_clock(tm);
+		return;
+	}
+	if (pacer_due(&clock_pacer, tm) &&
+		pacer_changed(&clock_pacer, clock_hash(tm))) {
+		render_clock(tm);
+		pacer_done(&clock_pacer, mtime());
+	}
+}
+
+/* Report (and reset) what the pacer did */
+void
+print_pacer_stats(void)
+{
+	struct pacer	*p = &clock_pacer;
+	uint32_t		avg;
+
+	avg = (p->rendered) ? p->cycles / p->rendered : 0;
+	printf("Pacing %s, %d fps target, now %d fps\n", (pace_frames) ? "on" : "off",
+		p->fps, p->fps / p->div);
+	printf("  %d rendered, %d skipped (unchanged), %d late, slowed %d times\n",
+		(int) p->rendered, (int) p->skipped, (int) p->late, (int) p->slowed);
+	printf("  render (uS) avg %d.%02d, max %d.%02d\n",
+		(int) (avg / 168), (int) ((avg % 168) * 100 / 168),
+		(int) (p->cycles_max / 168), (int) ((p->cycles_max % 168) * 100 / 168));
+	pacer_reset_stats(p);
+}
+
+int color;
+int dma_shift = 0;
+int dither = 0;
+int dirty_rows = 1;
+int fast_mode = 0; /* .1 sec or .0 sec mode */
+uint32_t last_time = 0;
+
+void qr_clock(uint32_t tm);
+
+int qr_ecc = QR_ECLEVEL_Q;
+void rotate_ecc_level(void);
+
+void
+rotate_ecc_level(void)
+{
+	switch (qr_ecc) {
+	case QR_ECLEVEL_L :
+		qr_ecc = QR_ECLEVEL_M;
+		break;
+	case QR_ECLEVEL_M :
+		qr_ecc = QR_ECLEVEL_Q;
+		break;
+	case QR_ECLEVEL_Q :
+		qr_ecc = QR_ECLEVEL_H;
+		break;
+	default:
+		qr_ecc = QR_ECLEVEL_L;
+		break;
+	}
+}
+
+int color_mode = 0;
+
+/*
+ * libqrencode mallocs and frees a lot for each code, so it is pointed
+ * at an arena for the encode and the arena is reset for the next one.
+ * That way every encode costs about the same and the heap never sees
+ * it. 'qr_cycles' is how long the encodes took, from DWT.
+ */
+#define QR_ARENA_SIZE	16384
+static uint8_t qr_arena_buf[QR_ARENA_SIZE];
+struct arena qr_arena;
+int use_arena = 1;
+static uint32_t qr_cycles;
+static uint32_t qr_max;
+static uint32_t qr_count;
+
+/*
+ * The QR clock pipeline
+ *
+ * What the clock will say next is known well ahead of time, so the
+ * codes for the next period (and the one after in fast mode, where a
+ * period is only 100mS) are encoded while the main loop has nothing
+ * else to do, and the next one is drawn into draw_buf. At the edge
+ * all that is left is frame_done(). If the code for the edge isn't
+ * ready (just started, the time was set, or the loop was held up) it
+ * is encoded there and then like it used to be, and counted as late.
+ *
+ * Latency is from the edge (by mtime()) to frame_done(), in mS.
+ */
+#define QR_PIPE_DEPTH	2
+#define QR_MAX_WIDTH	41		/* version 6, the time stamps are version 2 - 4 */
+
+struct qr_frame {
+	uint32_t	key;			/* mtime() / period of the edge it's for */
+	int			width;			/* 0 if nothing's there */
+	uint8_t		data[QR_MAX_WIDTH * QR_MAX_WIDTH];
+};
+
+static struct qr_frame qr_pipe[QR_PIPE_DEPTH];
+int qr_pipeline = 1;
+static uint32_t qr_armed;		/* key of the frame waiting in draw_buf */
+static int qr_config = -1;		/* what the frames were drawn with */
+static uint32_t qr_est;			/* encode time to allow for, in cycles */
+static uint32_t qr_ontime;
+static uint32_t qr_late;
+static uint32_t qr_lat_total;
+static uint32_t qr_lat_max;
+
+void
+qr_pipe_flush(void)
+{
+	int	i;
+
+	for (i = 0; i < QR_PIPE_DEPTH; i++) {
+		qr_pipe[i].width = 0;
+	}
+	qr_armed = last_time = (uint32_t) -1;
+}
+
+/*
+ * The time stamps all have the same length and are encoded at one
+ * ECC level, so unless 'qr_fast' is turned off they go through the
+ * specialized encoder (../util/qrfast.c), which doesn't allocate and
+ * only redoes what changed since the last one. libqrencode is still
+ * there for anything that encoder can't do.
+ */
+int qr_fast = 1;
+struct qrf_code qrf;
+
+static int
+qr_encode_text(struct qr_frame *f, const char *text)
+{
+	QRcode *my_qr;
+
+	f->width = 0;
+	if (qr_fast) {
+		if (((qrf.len == (int) strlen(text)) && (qrf.level == qr_ecc)) ||
+			(qrf_setup(&qrf, qr_ecc, strlen(text)) == 0)) {
+			qrf_encode(&qrf, text);
+			memcpy(f->data, qrf.data, qrf.width * qrf.width);
+			f->width = qrf.width;
+			return 0;
+		}
+	}
+	if (use_arena) {
+		arena_reset(&qr_arena);
+		arena_use(&qr_arena);
+	}
+	my_qr = QRcode_encodeString(text, 0, qr_ecc, QR_MODE_8, 1);
+	if (use_arena) {
+		/*
+		 * The library may cache tables between calls, they are
+		 * in the arena too so drop them before it is reset.
+		 */
+		QRcode_clearCache();
+		arena_use(NULL);
+	}
+	if (my_qr == NULL) {
+		return -1;
+	}
+	if (my_qr->width <= QR_MAX_WIDTH) {
+		memcpy(f->data, my_qr->data, my_qr->width * my_qr->width);
+		f->width = my_qr->width;
+	}
+	QRcode_free(my_qr);
+	return (f->width) ? 0 : -1;
+}
+
+/* Encode the time stamp of edge 'key' into 'f', 0 if it worked */
+static int
+qr_encode(struct qr_frame *f, uint32_t key, uint32_t period)
+{
+	uint32_t start;
+	int res;
+
+	start = dwt_read_cycle_counter();
+	res = qr_encode_text(f, time_stamp(time_get(key * period), fast_mode));
+	start = dwt_read_cycle_counter() - start;
+	qr_cycles += start;
+	if (start > qr_max) {
+		qr_max = start;
+	}
+	qr_count++;
+	qr_est = (start > qr_est) ? start : qr_est - (qr_est >> 3);
+	f->key = key;
+	return res;
+}
+
+/*
+ * Encode the next QR_BENCH_FRAMES time stamps (in the current mode)
+ * with each encoder and print the cycles per frame.
+ */
+#define QR_BENCH_FRAMES	100
+
+void
+qr_bench(void)
+{
+	static struct qr_frame f;
+	uint32_t	tm, period, start, cycles, total, max;
+	int			i, enc, save;
+
+	save = qr_fast;
+	period = (fast_mode) ? 100 : 1000;
+	tm = mtime();
+	for (enc = 1; enc >= 0; enc--) {
+		qr_fast = enc;
+		total = max = 0;
+		for (i = 0; i < QR_BENCH_FRAMES; i++) {
+			start = dwt_read_cycle_counter();
+			qr_encode_text(&f, time_stamp(time_get(tm + i * period), fast_mode));
+			cycles = dwt_read_cycle_counter() - start;
+			total += cycles;
+			if (cycles > max) {
+				max = cycles;
+			}
+		}
+		printf("  %s: %d cycles per frame, max %d (version %d)\n",
+			(enc) ? "qrfast" : "libqrencode", (int) (total / QR_BENCH_FRAMES),
+			(int) max, (f.width - 17) / 4);
+	}
+	qr_fast = save;
+}
+
+/* Draw an encoded frame into draw_buf */
+static void
+qr_draw(struct qr_frame *f)
+{
+	int x, y, inset, size;
+
+	if ((f->width * 2) < 64) {
+		inset = (64 - (f->width * 2)) / 2;
+		size = 2;
+	} else {
+		inset = (64 - f->width) / 2;
+		size = 1;
+	}
+	gfx_fillScreen(hub75_colors[color]);
+	for (x = 0; x < f->width; x++) {
+		for (y = 0; y < f->width; y++) {
+			int foo = f->data[y * f->width + x];
+			int cc = hub75_colors[color];
+			if (foo & 1) {
+				cc = LED_BLACK;
+			}
+			if (color_mode) {
+				if (foo & 2) {
+					cc = LED_RED;
+				}
+				if (foo & 0x80) {
+					cc = LED_BLUE;
+				}
+			}
+			if (foo & 1) {
+				if (size == 1) {
+					gfx_drawPixel(x + inset, y + inset, cc);
+				} else {
+					gfx_drawRect((x*2)+inset, (y*2)+inset, 2, 2, cc);
+				}
+			}
+		}
+	}
+}
+
+/* The frame in the pipeline for edge 'key', if there is one */
+static struct qr_frame *
+qr_find(uint32_t key)
+{
+	int	i;
+
+	for (i = 0; i < QR_PIPE_DEPTH; i++) {
+		if (qr_pipe[i].width && (qr_pipe[i].key == key)) {
+			return &qr_pipe[i];
+		}
+	}
+	return NULL;
+}
+
+/* A slot to encode into, one that is empty or has already been shown */
+static struct qr_frame *
+qr_slot(uint32_t key)
+{
+	int	i;
+
+	for (i = 0; i < QR_PIPE_DEPTH; i++) {
+		if ((qr_pipe[i].width == 0) || (qr_pipe[i].key <= key)) {
+			return &qr_pipe[i];
+		}
+	}
+	return &qr_pipe[0];
+}
+
+void
+qr_clock(uint32_t tm)
+{
+	struct qr_frame *f;
+	uint32_t key, period, left, lat;
+	int i, config, depth;
+
+	period = (fast_mode) ? 100 : 1000;
+	depth = (fast_mode) ? 2 : 1;
+	key = tm / period;
+
+	/* anything drawn or encoded ahead is no good if these change */
+	config = fast_mode | (color << 1) | (color_mode << 4) | (qr_ecc << 5);
+	if (config != qr_config) {
+		qr_config = config;
+		qr_pipe_flush();
+	}
+
+	if (key != last_time) {
+		/* the edge, show what's ready or make it now */
+		f = qr_find(key);
+		if (qr_pipeline && (qr_armed == key)) {
+			qr_ontime++;
+		} else {
+			if ((f == NULL) || (! qr_pipeline)) {
+				f = qr_slot(key);
+				if (qr_encode(f, key, period) < 0) {
+					return;
+				}
+			}
+			qr_draw(f);
+			qr_late++;
+		}
+		frame_done();
+		lat = mtime() - key * period;
+		qr_lat_total += lat;
+		if (lat > qr_lat_max) {
+			qr_lat_max = lat;
+		}
+		if (f != NULL) {
+			f->width = 0;
+		}
+		last_time = key;
+		qr_armed = (uint32_t) -1;
+		return;
+	}
+	if (! qr_pipeline) {
+		return;
+	}
+
+	/*
+	 * Idle, fill the pipeline one encode per call so the console
+	 * still gets looked at. Anything but the very next frame is only
+	 * started if it should finish before the edge.
+	 */
+	left = ((key + 1) * period - tm) * (HUB75_CYCLES_PER_SEC / 1000);
+	for (i = 1; i <= depth; i++) {
+		if (qr_find(key + i) != NULL) {
+			continue;
+		}
+		if ((i > 1) && (qr_est > left)) {
+			return;
+		}
+		qr_encode(qr_slot(key), key + i, period);
+		return;
+	}
+	if ((qr_armed != key + 1) && ((f = qr_find(key + 1)) != NULL)) {
+		qr_draw(f);
+		qr_armed = key + 1;
+	}
+}
+
+/*
+ * Report (and reset) how long QR encodes are taking and what they do
+ * to the heap and the arena.
+ */
+void
+print_qr_stats(void)
+{
+	struct heap_stats hs;
+	uint32_t	avg;
+
+	avg = (qr_count) ? qr_cycles / qr_count : 0;
+	printf("QR encode (%s): %d codes, (uS) avg %d, max %d\n",
+		(qr_fast) ? "qrfast" : (use_arena) ? "arena" : "heap", (int) qr_count,
+		(int) (avg / 168), (int) (qr_max / 168));
+	if (qrf.full + qrf.partial) {
+		printf("qrfast: version %d mask %d, %d full, %d incremental encodes, "
+			"%d codewords redone\n", qrf.version, qrf.mask, (int) qrf.full,
+			(int) qrf.partial, (int) qrf.changed);
+	}
+	printf("Arena: %d of %d bytes peak, %d blocks, %d overflowed to the heap\n",
+		(int) qr_arena.peak, (int) qr_arena.size, (int) qr_arena.allocs,
+		(int) qr_arena.overflows);
+	heap_get_stats(&hs);
+	printf("Heap: %d bytes live in %d blocks, peak %d, heap %d bytes, "
+		"%d free in %d pieces\n",
+		(int) hs.live, (int) hs.blocks, (int) hs.peak, (int) hs.heap,
+		(int) hs.free, (int) hs.free_blocks);
+	avg = (qr_ontime + qr_late) ? qr_lat_total / (qr_ontime + qr_late) : 0;
+	printf("QR frames: %d on time, %d late, edge to frame (mS) avg %d, max %d\n",
+		(int) qr_ontime, (int) qr_late, (int) avg, (int) qr_lat_max);
+	qr_cycles = qr_max = qr_count = 0;
+	qr_ontime = qr_late = qr_lat_total = qr_lat_max = 0;
+	arena_reset_stats(&qr_arena);
+	heap_reset_peak();
+}
+
+/*
+ * Four bands of ramps from black to full red, green, blue and white,
+ * for looking at gamma and dithering (banding shows up at the dark
+ * end first).
+ */
+void
+draw_ramps(void)
+{
+	int	x, v;
+
+	for (x = 0; x < DISPWIDTH; x++) {
+		v = (x * 255) / (DISPWIDTH - 1);
+		gfx_drawLine(x, 0, x, 15, RGB565(v, 0, 0));
+		gfx_drawLine(x, 16, x, 31, RGB565(0, v, 0));
+		gfx_drawLine(x, 32, x, 47, RGB565(0, 0, v));
+		gfx_drawLine(x, 48, x, 63, RGB565(v, v, v));
+	}
+}
+
+/*
+ * How much encoding the BCM engine has done for new frames, and what
+ * fraction of the scan rows it had to encode.
+ */
+void
+print_encode_stats(void)
+{
+	struct hub75_encode_stats es;
+	uint32_t	possible;
+
+	hub75_get_encode_stats(&es);
+	hub75_reset_encode_stats();
+	possible = es.new_frames * demo->geometry->scan;
+	printf("Encode: %d frames, %d new, %d of %d rows (%d%%) encoded\n",
+		(int) es.frames, (int) es.new_frames, (int) es.rows, (int) possible,
+		(int) ((possible) ? (es.rows * 100) / possible : 0));
+	printf("    %d cycles per new frame, worst frame %d cycles\n",
+		(int) ((es.new_frames) ? es.cycles / es.new_frames : 0),
+		(int) es.cycles_max);
+}
+
+/*
+ * How many frames were drawn, shown, dropped and repeated, how long
+ * they waited to be shown, and how fast the panel is refreshing.
+ */
+void
+print_frame_stats(void)
+{
+	struct hub75_scan_stats ss;
+	uint32_t	lat_avg;
+
+	hub75_get_scan_stats(&ss);
+	lat_avg = (frames.shown) ? (uint32_t) (frames.lat_total / frames.shown) : 0;
+	printf("Frames: %d drawn, %d shown, %d dropped, %d repeated\n",
+		(int) frames.published, (int) frames.shown,
+		(int) frames.dropped, (int) frames.repeated);
+	printf("    drawn to shown (uS): avg %d, max %d\n",
+		(int) (lat_avg / 168), (int) (frames.lat_max / 168));
+	printf("Refresh: %d Hz, %d new frames/s, row period (uS) avg %d max %d\n",
+		(int) ss.refresh_hz, (int) ss.swaps_hz,
+		(int) (ss.row_avg / 168), (int) (ss.row_max / 168));
+	tribuf_reset_stats(&frames);
+}
+
+/*
+ * Show frames streamed from the host (tools/hub75_stream.py) until it
+ * is done with the panel, then say how it went.
+ */
+uint8_t stream_buf[STREAM_DELTA_MAX];
+
+static const struct stream_panel stream_panel = {
+	DISPWIDTH, DISPHEIGHT, &draw_buf, &display_buf, frame_done, stream_buf
+};
+
+void
+run_stream(void)
+{
+	struct stream_stats	st;
+
+	printf("Streaming from the host ...\n");
+	stream_run(&stream_panel, &st);
+	printf("Stream: %d frames (%d deltas), %d screenshots, %d bytes\n",
+		(int) st.frames, (int) st.deltas, (int) st.shots, (int) st.bytes);
+	printf("Errors: %d bad messages, %d resyncs, %d timeouts\n",
+		(int) st.errors, (int) st.resyncs, (int) st.timeouts);
+	if (st.frames) {
+		printf("Check and unpack/apply (uS): avg %d, max %d\n",
+			(int) (st.cycles / st.frames / 168), (int) (st.cycles_max / 168));
+	}
+}
+
+/*
+ * A wall of boards side by side, each with its own panel (see
+ * ../util/wall.c). The master is on the left and draws the whole
+ * width: a bar sweeping across, a ball bouncing around and each
+ * board's number, so a board that changes late or tears stands out.
+ * It draws a slice at a time into draw_buf, the others' first, which
+ * wall_send() packs in place as RGB332 and has sent by the time it
+ * returns, then its own.
+ */
+#define WALL_FPS	30
+static uint16_t *wall_target;
+static int wall_x0;				/* wall x of the slice being drawn */
+
+void
+wall_pixel(int x, int y, uint16_t pix)
+{
+	x -= wall_x0;
+	if ((x >= 0) && (x < DISPWIDTH) && (y >= 0) && (y < DISPHEIGHT)) {
+		wall_target[y * DISPWIDTH + x] = pix;
+	}
+}
+
+/* 0 .. max and back again */
+static int
+wall_bounce(uint32_t n, int max)
+{
+	n %= 2 * max;
+	return (n < (uint32_t) max) ? (int) n : (int) (2 * max - n);
+}
+
+static void
+wall_scene(uint16_t *fb, int board, int boards, uint32_t frame)
+{
+	char	num[4];
+	int		w = boards * DISPWIDTH;
+
+	wall_target = fb;
+	wall_x0 = board * DISPWIDTH;
+	memset(fb, 0, DISPWIDTH * DISPHEIGHT * sizeof(uint16_t));
+	gfx_fillRect((frame * 2) % w, 0, 4, DISPHEIGHT, LED_WHITE);
+	gfx_fillCircle(wall_bounce(frame * 3, w - 9) + 4,
+					wall_bounce(frame * 2, DISPHEIGHT - 9) + 4, 4, LED_RED);
+	snprintf(num, sizeof(num), "%d", board);
+	gfx_setTextColor(LED_BLUE, LED_BLACK);
+	gfx_setCursor(wall_x0 + 24, 40);
+	gfx_puts((unsigned char *) num);
+}
+
+void
+print_wall_stats(const struct wall_stats *st)
+{
+	printf("Wall: %d frames shown, %d slices, %d missed syncs, %d overruns\n",
+		(int) st->frames, (int) st->slices, (int) st->missed, (int) st->overruns);
+	printf("Errors: %d bad slices, %d resyncs, %d timeouts\n",
+		(int) st->errors, (int) st->resyncs, (int) st->timeouts);
+	if (st->lit) {
+		printf("Sync to lit (uS): avg %d, min %d, max %d\n",
+			(int) (st->lag_total / st->lit / 168), (int) (st->lag_min / 168),
+			(int) (st->lag_max / 168));
+	}
+}
+
+/* Draw the wall and send the other 'boards' - 1 boards their slices */
+void
+run_wall_master(int boards)
+{
+	struct wall_stats	st;
+	struct pacer		pace;
+	uint32_t			frame, start, cycles, total, most;
+	int					b, y;
+
+	if ((boards < 2) || (boards > WALL_MAX_BOARDS)) {
+		printf("\nA wall is 2 to %d boards\n", WALL_MAX_BOARDS);
+		return;
+	}
+	printf("\nBoard 0 of %d, press a key to stop\n", boards);
+	wall_begin(&stream_panel, 0, &st);
+	gfx_init(wall_pixel, boards * DISPWIDTH, DISPHEIGHT, GFX_FONT_LARGE);
+	gfx_setMirrored(0);
+	pacer_init(&pace, WALL_FPS);
+	frame = total = most = 0;
+	while (console_getc(0) == 0) {
+		if (! pacer_due(&pace, mtime())) {
+			continue;
+		}
+		start = dwt_read_cycle_counter();
+		/* the others first, they unpack while this one draws */
+		for (b = boards - 1; b > 0; b--) {
+			wall_scene(draw_buf, b, boards, frame);
+			wall_send(b, draw_buf, STREAM_RGB332, frame);
+		}
+		wall_scene(draw_buf, 0, boards, frame);
+		for (y = 0; y < DISPHEIGHT; y++) {
+			hub75_dirty(y);
+		}
+		wall_sync();
+		cycles = dwt_read_cycle_counter() - start;
+		total += cycles / 168;
+		if (cycles > most) {
+			most = cycles;
+		}
+		frame++;
+	}
+	wall_end();
+	gfx_init(draw_pixel, DISPWIDTH, DISPHEIGHT, GFX_FONT_LARGE);
+	gfx_setMirrored(flip_it);
+	print_wall_stats(&st);
+	if (frame) {
+		printf("Draw, send and sync (uS): avg %d, max %d\n",
+			(int) (total / frame), (int) (most / 168));
+	}
+}
+
+/* Show board 'board''s slice of the wall, as the master sends them */
+void
+run_wall_board(int board)
+{
+	struct wall_stats	st;
+
+	if ((board < 1) || (board >= WALL_MAX_BOARDS)) {
+		printf("\nBoards of the wall are 1 to %d\n", WALL_MAX_BOARDS - 1);
+		return;
+	}
+	printf("\nBoard %d of the wall, press a key to stop\n", board);
+	wall_begin(&stream_panel, board, &st);
+	while (console_getc(0) == 0) {
+		wall_poll();
+	}
+	wall_end();
+	print_wall_stats(&st);
+}
+
+/*
+ * Scrolling text across the top and bottom of the panel, over whatever
+ * else is shown. Each strip is drawn once and the scan moves it (see
+ * ../util/ticker.c), so it costs nothing to draw while it scrolls.
+ * There is no RAM to spare for the strips, so they borrow face_buf
+ * (they need 7424 of its 8192 pixels) and the clock draws its face
+ * every frame while they are on.
+ */
+#define TITLE_ROWS	14
+#define TITLE_STRIP	(TITLE_ROWS * 256)
+#define FOOT_ROWS	10
+#define FOOT_STRIP	(FOOT_ROWS * 384)
+struct ticker *title_ticker;
+struct ticker *foot_ticker;
+
+/* title speeds to step through, Q16 pixels per second */
+static const int32_t ticker_speeds[] = {
+	1 << 14, 1 << 16, 5 << 16, 20 << 16, 60 << 16
+};
+int title_speed = 3;
+
+/* Draw 'text' into a ticker's strip with the gfx library */
+void
+ticker_text(struct ticker *t, int font, int baseline, uint16_t fg,
+			const char *text)
+{
+	ticker_begin(t, LED_BLACK);
+	gfx_init(ticker_pixel, t->stride - t->width, t->height, font);
+	gfx_setMirrored(0);
+	gfx_setTextColor(fg, LED_BLACK);
+	gfx_setCursor(0, baseline);
+	gfx_puts((unsigned char *) text);
+	ticker_end(t, DISPWIDTH / 4);
+	gfx_init(draw_pixel, DISPWIDTH, DISPHEIGHT, GFX_FONT_LARGE);
+	gfx_setMirrored(flip_it);
+}
+
+void
+ticker_demo(void)
+{
+	char	foot[64];
+
+	if (title_ticker != NULL) {
+		ticker_remove(title_ticker);
+		ticker_remove(foot_ticker);
+		title_ticker = foot_ticker = NULL;
+		/* the strips were drawn over the cached face */
+		face_key = -1;
+		face_lent = 0;
+		printf("Tickers off\n");
+		return;
+	}
+	if (packed_show) {
+		printf("The packed frame buffer is using face_buf, turn it off ('v') first\n");
+		return;
+	}
+	face_lent = 1;
+	title_ticker = ticker_add(0, TITLE_ROWS, DISPWIDTH, face_buf, TITLE_STRIP);
+	foot_ticker = ticker_add(DISPHEIGHT - FOOT_ROWS, FOOT_ROWS, DISPWIDTH,
+						face_buf + TITLE_STRIP, FOOT_STRIP);
+	if ((title_ticker == NULL) || (foot_ticker == NULL)) {
+		if (title_ticker != NULL) {
+			ticker_remove(title_ticker);
+		}
+		title_ticker = foot_ticker = NULL;
+		face_lent = 0;
+		printf("No room for the tickers\n");
+		return;
+	}
+	ticker_text(title_ticker, GFX_FONT_LARGE, 12, LED_YELLOW, "1Bitsy HUB75");
+	ticker_speed(title_ticker, ticker_speeds[title_speed]);
+	snprintf(foot, sizeof(foot), "Scrolled by the scan since %s",
+				time_stamp(time_get(mtime()), 0));
+	ticker_text(foot_ticker, GFX_FONT_SMALL, 8, LED_CYAN, foot);
+	/* 12.5 pixels a second, to the right */
+	ticker_speed(foot_ticker, -(25 << 16) / 2);
+	printf("Tickers on\n");
+}
+
+/* Step the title through its speeds */
+void
+ticker_faster(void)
+{
+	int32_t	v;
+
+	if (title_ticker == NULL) {
+		printf("Tickers are off\n");
+		return;
+	}
+	title_speed = (title_speed + 1) % (sizeof(ticker_speeds) / sizeof(int32_t));
+	v = ticker_speeds[title_speed];
+	ticker_speed(title_ticker, v);
+	printf("Title scrolls at %d.%02d pixels a second\n", (int) (v >> 16),
+		(int) (((v & 0xffff) * 100) >> 16));
+}
+
+/* gfx pixel function for the packed frame buffer */
+void
+packed_pixel(int x, int y, uint16_t pix)
+{
+	if ((x >= 0) && (x < DISPWIDTH) && (y >= 0) && (y < DISPHEIGHT)) {
+		hub75_packed_pixel(packed_buf, DISPWIDTH, x, y, RGB565_TO_3BIT(pix));
+	}
+}
+
+/*
+ * Draw the packed_report() scene on 'n' panels side by side, RGB565
+ * or packed, a pixel at a time or (clearing and the bars) with spans.
+ * Each panel is cleared a row at a time and gets 16 bars, and there
+ * are 1024 pixels across the lot. RGB565 is drawn a panel at a time
+ * into draw_buf, as only one panel's worth fits alongside everything
+ * else. Returns the cycles it took.
+ */
+#define SCENE_PIXEL(x, y, c)	\
+	if (packed) { \
+		hub75_packed_pixel(packed_buf, w, x0 + (x), y, c); \
+	} else { \
+		hub75_rgb565_pixel(draw_buf, DISPWIDTH, x, y, hub75_colors[c]); \
+	}
+
+#define SCENE_SPAN(x, y, len, c)	\
+	if (! spans) { \
+		for (i = 0; i < (len); i++) { \
+			SCENE_PIXEL((x) + i, y, c); \
+		} \
+	} else if (packed) { \
+		hub75_packed_span(packed_buf, w, x0 + (x), y, len, c); \
+	} else { \
+		hub75_rgb565_span(draw_buf, DISPWIDTH, x, y, len, hub75_colors[c]); \
+	}
+
+uint32_t
+packed_scene(int n, int packed, int spans)
+{
+	uint32_t	start, r = 1;
+	int			w = n * DISPWIDTH, x0, tile, i, y;
+
+	start = dwt_read_cycle_counter();
+	for (tile = 0; tile < n; tile++) {
+		x0 = tile * DISPWIDTH;
+		for (y = 0; y < DISPHEIGHT; y++) {
+			SCENE_SPAN(0, y, DISPWIDTH, 0);
+		}
+		for (y = 0; y < DISPHEIGHT; y += 4) {
+			SCENE_SPAN(4, y, DISPWIDTH - 8, (y >> 2) & 7);
+		}
+		for (i = 0; i < 1024 / n; i++) {
+			r = r * 1103515245 + 12345;
+			SCENE_PIXEL((r >> 20) % DISPWIDTH, (r >> 8) % DISPHEIGHT, r & 7);
+		}
+	}
+	return dwt_read_cycle_counter() - start;
+}
+
+#undef SCENE_PIXEL
+#undef SCENE_SPAN
+
+/*
+ * Compare RGB565 and packed frame buffers for 1, 2 and 4 panels in a
+ * row: the memory three of them take (a triple buffer) and the time
+ * to draw the same scene into each, with the same primitives, a pixel
+ * at a time and with spans. The packed buffer is face_buf, which the
+ * caller has to have lent it.
+ */
+void
+packed_report(void)
+{
+	int			n, w;
+
+	printf("              RGB565 x3                 Packed x3\n");
+	printf("Panels Width  bytes  pixel uS  span uS  bytes  pixel uS  span uS\n");
+	for (n = 1; n <= 4; n <<= 1) {
+		w = n * DISPWIDTH;
+		printf("%6d %5d  %5d  %8d  %7d  %5d  %8d  %7d\n", n, w,
+			3 * w * DISPHEIGHT * (int) sizeof(uint16_t),
+			(int) (packed_scene(n, 0, 0) / 168), (int) (packed_scene(n, 0, 1) / 168),
+			3 * HUB75_PACKED_BYTES(w, DISPHEIGHT),
+			(int) (packed_scene(n, 1, 0) / 168), (int) (packed_scene(n, 1, 1) / 168));
+	}
+	/* draw_buf was scribbled on */
+	for (n = 0; n < DISPHEIGHT; n++) {
+		hub75_dirty(n);
+	}
+}
+
+/*
+ * Show a test card from the packed frame buffer, or go back to the
+ * normal one. The plain scan's table path reads it directly.
+ */
+void
+packed_demo(void)
+{
+	int	y;
+
+	if (title_ticker != NULL) {
+		printf("The tickers are using face_buf, turn them off ('W') first\n");
+		return;
+	}
+	/* the clock draws its face itself while packed_buf is in use */
+	face_lent = 1;
+	packed_report();
+	packed_show = ! packed_show;
+	if (! packed_show) {
+		face_key = -1;
+		face_lent = 0;
+		printf("Showing the RGB565 frame buffer\n");
+		return;
+	}
+	hub75_packed_span(packed_buf, DISPWIDTH, 0, 0, DISPWIDTH * DISPHEIGHT, 0);
+	gfx_init(packed_pixel, DISPWIDTH, DISPHEIGHT, GFX_FONT_LARGE);
+	gfx_setMirrored(0);
+	gfx_drawRoundRect(0, 0, 64, 64, 5, LED_BLUE);
+	gfx_setTextColor(LED_GREEN, LED_BLACK);
+	gfx_setCursor(4, 14);
+	gfx_puts((unsigned char *) "Packed");
+	gfx_setFont(GFX_FONT_SMALL);
+	gfx_setTextColor(LED_YELLOW, LED_BLACK);
+	gfx_setCursor(6, 28);
+	gfx_puts((unsigned char *) "4 bits a");
+	gfx_setCursor(6, 38);
+	gfx_puts((unsigned char *) "pixel");
+	gfx_init(draw_pixel, DISPWIDTH, DISPHEIGHT, GFX_FONT_LARGE);
+	gfx_setMirrored(flip_it);
+	for (y = 0; y < 8; y++) {
+		hub75_packed_span(packed_buf, DISPWIDTH, 4, 44 + 2 * y, 56, y);
+	}
+	lut_scan = 1;
+	printf("Showing the packed frame buffer%s\n",
+		(hub75_bcm_depth()) ? " (with the plain scan, 'b' 0)" : "");
+}
+
+/*
+ * Run the demo on the panels 'd' describes, starting with its row
+ * scan. Never returns.
+ */
+void
+panel_demo(const struct panel_demo *d)
+{
+	int cnt;
+	char key;
+	int clock_running = d->clock_running;
+	int qclock_running = 0;
+	int refresh = d->refresh;
+
+	demo = d;
+
+	printf("LED Panel Demo\n");
+	tribuf_init(&frames, buf1, buf2, buf3);
+	arena_init(&qr_arena, qr_arena_buf, sizeof(qr_arena_buf));
+	draw_buf = &buf1[0];
+	display_buf = &buf3[0];
+
+	gfx_init(draw_pixel, DISPWIDTH, DISPHEIGHT, GFX_FONT_LARGE);
+	gfx_fillScreen(LED_BLACK);
+	gfx_setCursor(0, 12);
+	gfx_setTextColor(LED_GREEN, LED_BLACK);
+	gfx_puts((unsigned char *) "1Bitsy");
+	gfx_setCursor(0, 24);
+	gfx_setTextColor(LED_MAGENTA, LED_BLACK);
+	gfx_puts((unsigned char *) " @esden");
+	gfx_drawRoundRect(0, 0, 64, 64, 5, LED_BLUE);
+	gfx_setCursor(4, 48); gfx_setTextColor(LED_YELLOW, LED_BLACK);
+	gfx_puts((unsigned char *)"Chuck");
+	gfx_setCursor(6, 62);
+	gfx_puts((unsigned char *)"McManis");
+	frame_done();
+
+	gpio_init();
+	cnt = 0;
+	gpio_set(GPIOC, LED_OE);
+	gpio_set(GPIOC, LED_LAT);
+	gpio_set(GPIOC, LED_CLK);
+	/* this should start drawing the buffer */
+	hub75_init(d->geometry, swap_buffers);
+	hub75_track_dirty(dirty_rows);
+	hub75_scan_start(d->scan, refresh);
+	
+	gpio_clear(GPIOC, GPIO3);
+	color = 3;
+	pacer_init(&clock_pacer, PACER_DEFAULT_FPS);
+	while(1) 
+	{
+		key = console_getc(0);
+		if (key) {
+			/* whatever it did, the clock is drawn again */
+			pacer_force(&clock_pacer);
+		}
+		switch (key) {
+			default:
+				break;
+			case '?':
+				printf("Commands - \n");
+				printf(" space - Turn off clocks, fill screen with color\n");
+				printf(" g - fill with small grid\n");
+				printf(" G - fill with large grid\n");
+				printf(" Q - show QR clock\n");
+				printf(" C - show regular clock\n");
+				printf(" c - change to one of 8 colors\n");
+				printf(" f - fast mode\n");
+				printf(" P - color mode\n");
+				printf(" T or d - set the time\n");
+				printf(" t - print the current time\n");
+				printf(" 2 - clock as GMT clock \n");
+				printf(" i - invert clock (mirrored)\n");
+				printf(" r - set the refresh rate in Hz\n");
+				printf(" S - measure refresh rate and CPU load at several rates\n");
+				printf(" B - set the brightness (0 - 255)\n");
+				printf(" l - show (and reset) row latency statistics\n");
+				printf(" b - set bits per color (BCM), 0 is the 8 color scan\n");
+				printf(" h - measure refresh rate at each BCM depth\n");
+				printf(" m - shift BCM rows with DMA or the CPU\n");
+				printf(" p - print scan cycles, switch table/set_pin() path\n");
+				printf(" y - set the BCM gamma\n");
+				printf(" x - BCM temporal dithering on/off\n");
+				printf(" R - show red, green, blue and white ramps\n");
+				printf(" n - show refresh rate and (reset) frame statistics\n");
+				printf(" k - show (and reset) BCM encode cost and dirty rows\n");
+				printf(" K - BCM dirty row tracking on/off\n");
+				printf(" F - print clock render time, switch cached/redrawn face\n");
+				printf(" M - print QR encode time and heap use, switch arena/heap\n");
+				printf(" j - QR clock pre-encoding on/off\n");
+				printf(" q - benchmark the QR encoders, switch qrfast/libqrencode\n");
+				printf(" Z - show frames streamed from the host\n");
+				printf(" Y - send a screenshot to the host\n");
+				printf(" W - scrolling text tickers on/off\n");
+				printf(" w - change the speed of the top ticker\n");
+				printf(" v - packed frame buffer report, show/hide its test card\n");
+				printf(" u - frame pacer report, turn pacing on/off\n");
+				printf(" U - set the clock's target frame rate\n");
+				printf(" o - be board 0 (the master) of a wall of boards\n");
+				printf(" O - be another board of the wall\n");
+				printf(" a - time the clock with sinf()/cosf() and with tables\n");
+				printf(" A - time and check the fast math against libm\n");
+				printf(" s - play (or stop) the spinner animation baked into flash\n");
+				break;
+
+			case ' ':
+				clock_running = 0;
+				qclock_running = 0;
+				gfx_fillScreen(hub75_colors[color]);
+				frame_done();
+				break;
+			case 'g':
+				clock_running = 0;
+				qclock_running = 0;
+				gfx_fillScreen(LED_BLACK);
+				for (cnt = 0; cnt < 64; cnt++) {
+					if (((cnt % 4) == 0) || (cnt == 63)) {
+						gfx_drawLine(cnt, 0, cnt, 63, hub75_colors[color]);
+						gfx_drawLine(0, cnt, 63, cnt, hub75_colors[color]);
+					}
+				}
+				frame_done();
+				break;
+			case 'G':
+				qclock_running = 0;
+				clock_running = 0;
+				gfx_fillScreen(LED_BLACK);
+				for (cnt = 0; cnt < 64; cnt++) {
+					if (((cnt % 8) == 0) || (cnt == 63)) {
+						gfx_drawLine(cnt, 0, cnt, 63, hub75_colors[color]);
+						gfx_drawLine(0, cnt, 63, cnt, hub75_colors[color]);
+					}
+				}
+				frame_done();
+				break;
+			case 'c':
+				color = (color + 1) & 7;
+				if (color == 0) color = 1;
+				printf("Color is now : %d\n", color);
+				break;
+			case 'C':
+				qclock_running = 0;
+				clock_running = 1;
+				break;
+			case 'Q':
+				clock_running = 0;
+				qclock_running++;
+				qr_pipe_flush();
+				break;
+			case 'f':
+				fast_mode = (fast_mode != 0) ? 0 : 1;
+				printf("Fast mode: %s\n", (fast_mode) ? "ON" : "OFF");
+				break;
+			case 't':
+				printf(" TIME: %s\n", time_stamp(time_get(mtime()),1));
+				break;
+			case 'e':
+				rotate_ecc_level();
+				break;
+			case 'l':
+				print_defer_stats();
+				break;
+			case 'r':
+				console_puts("Enter refresh rate (Hz): ");
+				cnt = console_getnumber();
+				if ((hub75_bcm_depth() == 0) && (set_depth(0, cnt) < 0)) {
+					printf("\nCan't refresh at %d Hz\n", cnt);
+				} else {
+					refresh = cnt;
+					printf("\nRefresh set to %d Hz\n", refresh);
+				}
+				break;
+			case 'B':
+				console_puts("Enter brightness (0 - 255): ");
+				cnt = console_getnumber();
+				hub75_brightness(cnt);
+				printf("\nBrightness: %d\n", hub75_get_brightness());
+				break;
+			case 'S':
+				printf("Sweeping the refresh rate ...\n");
+				scan_sweep(refresh);
+				break;
+			case 'b':
+				console_puts("Enter bits per color (0 = off, 1 - 8): ");
+				cnt = console_getnumber();
+				if (set_depth(cnt, refresh) < 0) {
+					printf("\nCan't do %d bits per color\n", cnt);
+				} else {
+					printf("\nBits per color: %d\n", hub75_bcm_depth());
+				}
+				break;
+			case 'h':
+				printf("Measuring refresh rate ...\n");
+				refresh_sweep(refresh);
+				break;
+			case 'y':
+				console_puts("Enter gamma x 10 (10 is linear): ");
+				cnt = console_getnumber();
+				if (cnt > 0) {
+					hub75_bcm_gamma(cnt / 10.0f);
+				}
+				cnt = (int) (hub75_bcm_get_gamma() * 10 + 0.5f);
+				printf("\nGamma: %d.%d\n", cnt / 10, cnt % 10);
+				break;
+			case 'x':
+				dither = ! dither;
+				hub75_bcm_dither(dither);
+				printf("Temporal dithering: %s\n", (dither) ? "ON" : "OFF");
+				break;
+			case 'R':
+				clock_running = 0;
+				qclock_running = 0;
+				draw_ramps();
+				frame_done();
+				break;
+			case 'n':
+				print_frame_stats();
+				break;
+			case 'k':
+				print_encode_stats();
+				break;
+			case 'M':
+				print_qr_stats();
+				use_arena = ! use_arena;
+				printf("QR codes now encoded from the %s\n", (use_arena) ? "arena" : "heap");
+				break;
+			case 'q':
+				printf("Encoding %d time stamps ...\n", QR_BENCH_FRAMES);
+				qr_bench();
+				qr_fast = ! qr_fast;
+				qr_pipe_flush();
+				printf("QR clock now uses %s\n", (qr_fast) ? "qrfast" : "libqrencode");
+				break;
+			case 'j':
+				qr_pipeline = ! qr_pipeline;
+				qr_pipe_flush();
+				printf("QR pre-encoding: %s\n", (qr_pipeline) ? "ON" : "OFF");
+				break;
+			case 'Z':
+				clock_running = 0;
+				qclock_running = 0;
+				run_stream();
+				break;
+			case 'Y':
+				stream_shot(&stream_panel);
+				break;
+			case 'W':
+				ticker_demo();
+				break;
+			case 'w':
+				ticker_faster();
+				break;
+			case 'v':
+				packed_demo();
+				break;
+			case 'o':
+				clock_running = 0;
+				qclock_running = 0;
+				console_puts("Enter boards in the wall: ");
+				run_wall_master(console_getnumber());
+				break;
+			case 'O':
+				clock_running = 0;
+				qclock_running = 0;
+				console_puts("Enter this board's number: ");
+				run_wall_board(console_getnumber());
+				break;
+			case 'u':
+				print_pacer_stats();
+				pace_frames = ! pace_frames;
+				printf("Frame pacing is now %s\n", (pace_frames) ? "on" : "off");
+				break;
+			case 'U':
+				console_puts("Enter clock frames per second: ");
+				cnt = console_getnumber();
+				pacer_init(&clock_pacer, cnt);
+				printf("\nPacing the clock at %d fps\n", clock_pacer.fps);
+				break;
+			case 'a':
+				dial_bench();
+				break;
+			case 'A':
+				math_bench();
+				break;
+			case 's':
+				play_spinner(refresh);
+				break;
+			case 'F':
+				print_render_stats();
+				cached_face = ! cached_face;
+				printf("Clock face is now %s\n", (cached_face) ? "cached" : "redrawn");
+				break;
+			case 'K':
+				dirty_rows = ! dirty_rows;
+				hub75_track_dirty(dirty_rows);
+				printf("Dirty row tracking: %s\n", (dirty_rows) ? "ON" : "OFF");
+				break;
+			case 'p':
+				print_scan_cycles();
+				lut_scan = ! lut_scan;
+				printf("Now using the %s path\n", (lut_scan) ? "table" : "set_pin()");
+				break;
+			case 'm':
+				if (hub75_bcm_dma(! dma_shift) < 0) {
+					printf("\nRows are too long for DMA\n");
+				} else {
+					dma_shift = ! dma_shift;
+					printf("\nRow shifting: %s\n", (dma_shift) ? "DMA" : "CPU");
+				}
+				break;
+			case 'T':
+			case 'd':
+				time_set();
+				break;
+			case 'P':
+				color_mode = (color_mode == 0) ? 1 : 0;
+				break;
+			case '2':
+				gmt_clock = (gmt_clock == 0) ? 1 : 0;
+				break;
+			case 'i':
+				flip_it = (flip_it == 0) ? 1 : 0;
+				gfx_setMirrored(flip_it);
+				break;
+		}
+		if (clock_running) {
+			paced_clock();
+		} else if (qclock_running) {
+			qr_clock(mtime());
+		}
+
+	}
+}
+
+/*
+ * time_string(uint32_t)
+ *
+ * Convert a number representing milliseconds into a 'time' string
+ * of HHH:MM:SS.mmm where HHH is hours, MM is minutes, SS is seconds
+ * and .mmm is fractions of a second.
+ *
+ * Uses a static buffer (not multi-thread friendly)
+ */
+unsigned char *
+time_string(uint32_t t)
+{
+    static unsigned char time_string[14];
+    uint16_t msecs = t % 1000;
+    uint8_t secs = (t / 1000) % 60;
+    uint8_t mins = (t / 60000) % 60;
+    uint16_t hrs = (t /3600000);
+
+    // HH:MM:SS.mmm\0
+    // 0123456789abc
+    time_string[0] = (hrs / 100) % 10 + '0';
+    time_string[1] = (hrs / 10) % 10 + '0';
+    time_string[2] = hrs % 10 + '0';
+    time_string[3] = ':';
+    time_string[4] = (mins / 10)  % 10 + '0';
+    time_string[5] = mins % 10 + '0';
+    time_string[6] = ':';
+    time_string[7] = (secs / 10)  % 10 + '0';
+    time_string[8] = secs % 10 + '0';
+    time_string[9] = '.';
+    time_string[10] = (msecs / 100) % 10 + '0';
+    time_string[11] = (msecs / 10) % 10 + '0';
+    time_string[12] = msecs % 10 + '0';
+    time_string[13] = 0;
+    return &time_string[0];
+}
@@ -0,0 +1,44 @@
+/*
+ * paneldemo.h
+ *
+ * The clock demo that leds and led2 share, see paneldemo.c. Each demo
+ * has only what differs between their panels: the geometry, and the
+ * original row scan (the one bit per color scan, depth 0) that clocks
+ * a row out with set_pin() or through hub75_scan_row(). It fills in a
+ * struct panel_demo and calls panel_demo(), which never returns.
+ */
+#ifndef __PANELDEMO_H
+#define __PANELDEMO_H
+
+/* This is the LED display's "buffer" */
+#define DISPWIDTH	64
+#define DISPHEIGHT	64
+
+#define LED_LAT	GPIO8
+#define LED_CLK GPIO9
+#define LED_OE	GPIO7
+
+struct panel_demo {
+	const struct hub75_geometry	*geometry;
+	void		(*scan)(void);		/* the row scan, one row each call */
+	int			refresh;			/* the row scan's refreshes a second */
+	int			clock_running;		/* start with the clock showing */
+};
+
+/*
+ * What the row scan needs. It shows 'display_buf', or 'packed_buf'
+ * through the table if 'packed_show', clocks the rows out with
+ * hub75_scan_row() if 'lut_scan' or its own set_pin() loop if not,
+ * and adds the cycles that took to 'scan_cycles'.
+ */
+extern uint16_t *display_buf;
+extern uint8_t *const packed_buf;
+extern int lut_scan;
+extern int packed_show;
+extern uint32_t scan_cycles;
+extern uint32_t scan_count;
+
+uint16_t *swap_buffers(void);
+void panel_demo(const struct panel_demo *demo);
+
+#endif /* generic header protector */
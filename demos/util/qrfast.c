@@ -0,0 +1,578 @@
+/*
+ * qrfast.c -- allocation free QR encoder for the clock time stamps
+ *
+ * The clocks encode a string of the same length every time (the time
+ * stamp), in byte mode, at a given error correction level, so nearly
+ * everything about the code is known up front. qrf_setup() picks the
+ * version, draws the function patterns, works out which module each
+ * bit of each codeword goes in, and builds the Reed-Solomon tables.
+ * After that qrf_encode() only has to fill in codewords.
+ *
+ * Reed-Solomon is linear, the EC codewords of a block are the sum of
+ * what each data codeword on its own would give. So when a character
+ * changes, only that character's codewords are XORed into the EC with
+ * a precomputed vector per data position, and only the modules of the
+ * codewords that changed are redrawn. The mask is picked (by the usual
+ * penalty rules) on the first encode after qrf_setup() and then kept,
+ * which any reader is happy with, otherwise it would have to be picked
+ * again for every code and that alone would cost more than the rest.
+ *
+ * The GF(256) and generator polynomial tables were generated with the
+ * field polynomial 0x11d, the format information is the 15 bit BCH
+ * code for each level and mask, already XORed with 0x5412.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../util/qrfast.h"
+
+#define FUNC		0x80		/* finder, timing, alignment, format */
+#define DATA		0x02		/* data and EC codewords */
+#define DARK		0x01
+#define MASKED		0x8000		/* in bitpos[], the mask inverts this bit */
+
+static const uint8_t gf_exp[510] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26,
+	0x4c, 0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0,
+	0x9d, 0x27, 0x4e, 0x9c, 0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee, 0xc1, 0x9f, 0x23,
+	0x46, 0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d, 0xba, 0x69, 0xd2, 0xb9, 0x6f, 0xde, 0xa1,
+	0x5f, 0xbe, 0x61, 0xc2, 0x99, 0x2f, 0x5e, 0xbc, 0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0,
+	0xfd, 0xe7, 0xd3, 0xbb, 0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b, 0xb6, 0x71, 0xe2,
+	0xd9, 0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d, 0x1a, 0x34, 0x68, 0xd0, 0xbd, 0x67, 0xce,
+	0x81, 0x1f, 0x3e, 0x7c, 0xf8, 0xed, 0xc7, 0x93, 0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc,
+	0x85, 0x17, 0x2e, 0x5c, 0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84, 0x15, 0x2a, 0x54,
+	0xa8, 0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49, 0x92, 0x39, 0x72, 0xe4, 0xd5, 0xb7, 0x73,
+	0xe6, 0xd1, 0xbf, 0x63, 0xc6, 0x91, 0x3f, 0x7e, 0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff,
+	0xe3, 0xdb, 0xab, 0x4b, 0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5, 0x57, 0xae, 0x41,
+	0x82, 0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xdd, 0xa7, 0x53, 0xa6,
+	0x51, 0xa2, 0x59, 0xb2, 0x79, 0xf2, 0xf9, 0xef, 0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09,
+	0x12, 0x24, 0x48, 0x90, 0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb, 0x8b, 0x0b, 0x16,
+	0x2c, 0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b, 0x36, 0x6c, 0xd8, 0xad, 0x47, 0x8e, 0x01,
+	0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26, 0x4c,
+	0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x9d,
+	0x27, 0x4e, 0x9c, 0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee, 0xc1, 0x9f, 0x23, 0x46,
+	0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d, 0xba, 0x69, 0xd2, 0xb9, 0x6f, 0xde, 0xa1, 0x5f,
+	0xbe, 0x61, 0xc2, 0x99, 0x2f, 0x5e, 0xbc, 0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0xfd,
+	0xe7, 0xd3, 0xbb, 0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b, 0xb6, 0x71, 0xe2, 0xd9,
+	0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d, 0x1a, 0x34, 0x68, 0xd0, 0xbd, 0x67, 0xce, 0x81,
+	0x1f, 0x3e, 0x7c, 0xf8, 0xed, 0xc7, 0x93, 0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc, 0x85,
+	0x17, 0x2e, 0x5c, 0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84, 0x15, 0x2a, 0x54, 0xa8,
+	0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49, 0x92, 0x39, 0x72, 0xe4, 0xd5, 0xb7, 0x73, 0xe6,
+	0xd1, 0xbf, 0x63, 0xc6, 0x91, 0x3f, 0x7e, 0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff, 0xe3,
+	0xdb, 0xab, 0x4b, 0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5, 0x57, 0xae, 0x41, 0x82,
+	0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xdd, 0xa7, 0x53, 0xa6, 0x51,
+	0xa2, 0x59, 0xb2, 0x79, 0xf2, 0xf9, 0xef, 0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09, 0x12,
+	0x24, 0x48, 0x90, 0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb, 0x8b, 0x0b, 0x16, 0x2c,
+	0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b, 0x36, 0x6c, 0xd8, 0xad, 0x47, 0x8e,
+};
+
+static const uint8_t gf_log[256] = {
+	0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1a, 0xc6, 0x03, 0xdf, 0x33, 0xee, 0x1b, 0x68, 0xc7, 0x4b,
+	0x04, 0x64, 0xe0, 0x0e, 0x34, 0x8d, 0xef, 0x81, 0x1c, 0xc1, 0x69, 0xf8, 0xc8, 0x08, 0x4c, 0x71,
+	0x05, 0x8a, 0x65, 0x2f, 0xe1, 0x24, 0x0f, 0x21, 0x35, 0x93, 0x8e, 0xda, 0xf0, 0x12, 0x82, 0x45,
+	0x1d, 0xb5, 0xc2, 0x7d, 0x6a, 0x27, 0xf9, 0xb9, 0xc9, 0x9a, 0x09, 0x78, 0x4d, 0xe4, 0x72, 0xa6,
+	0x06, 0xbf, 0x8b, 0x62, 0x66, 0xdd, 0x30, 0xfd, 0xe2, 0x98, 0x25, 0xb3, 0x10, 0x91, 0x22, 0x88,
+	0x36, 0xd0, 0x94, 0xce, 0x8f, 0x96, 0xdb, 0xbd, 0xf1, 0xd2, 0x13, 0x5c, 0x83, 0x38, 0x46, 0x40,
+	0x1e, 0x42, 0xb6, 0xa3, 0xc3, 0x48, 0x7e, 0x6e, 0x6b, 0x3a, 0x28, 0x54, 0xfa, 0x85, 0xba, 0x3d,
+	0xca, 0x5e, 0x9b, 0x9f, 0x0a, 0x15, 0x79, 0x2b, 0x4e, 0xd4, 0xe5, 0xac, 0x73, 0xf3, 0xa7, 0x57,
+	0x07, 0x70, 0xc0, 0xf7, 0x8c, 0x80, 0x63, 0x0d, 0x67, 0x4a, 0xde, 0xed, 0x31, 0xc5, 0xfe, 0x18,
+	0xe3, 0xa5, 0x99, 0x77, 0x26, 0xb8, 0xb4, 0x7c, 0x11, 0x44, 0x92, 0xd9, 0x23, 0x20, 0x89, 0x2e,
+	0x37, 0x3f, 0xd1, 0x5b, 0x95, 0xbc, 0xcf, 0xcd, 0x90, 0x87, 0x97, 0xb2, 0xdc, 0xfc, 0xbe, 0x61,
+	0xf2, 0x56, 0xd3, 0xab, 0x14, 0x2a, 0x5d, 0x9e, 0x84, 0x3c, 0x39, 0x53, 0x47, 0x6d, 0x41, 0xa2,
+	0x1f, 0x2d, 0x43, 0xd8, 0xb7, 0x7b, 0xa4, 0x76, 0xc4, 0x17, 0x49, 0xec, 0x7f, 0x0c, 0x6f, 0xf6,
+	0x6c, 0xa1, 0x3b, 0x52, 0x29, 0x9d, 0x55, 0xaa, 0xfb, 0x60, 0x86, 0xb1, 0xbb, 0xcc, 0x3e, 0x5a,
+	0xcb, 0x59, 0x5f, 0xb0, 0x9c, 0xa9, 0xa0, 0x51, 0x0b, 0xf5, 0x16, 0xeb, 0x7a, 0x75, 0x2c, 0xd7,
+	0x4f, 0xae, 0xd5, 0xe9, 0xe6, 0xe7, 0xad, 0xe8, 0x74, 0xd6, 0xf4, 0xea, 0xa8, 0x50, 0x58, 0xaf,
+};
+
+static const uint8_t rs_gen_7[7] = {
+	0x7f, 0x7a, 0x9a, 0xa4, 0x0b, 0x44, 0x75,
+};
+
+static const uint8_t rs_gen_10[10] = {
+	0xd8, 0xc2, 0x9f, 0x6f, 0xc7, 0x5e, 0x5f, 0x71, 0x9d, 0xc1,
+};
+
+static const uint8_t rs_gen_13[13] = {
+	0x89, 0x49, 0xe3, 0x11, 0xb1, 0x11, 0x34, 0x0d, 0x2e, 0x2b, 0x53, 0x84, 0x78,
+};
+
+static const uint8_t rs_gen_15[15] = {
+	0x1d, 0xc4, 0x6f, 0xa3, 0x70, 0x4a, 0x0a, 0x69, 0x69, 0x8b, 0x84, 0x97, 0x20, 0x86, 0x1a,
+};
+
+static const uint8_t rs_gen_16[16] = {
+	0x3b, 0x0d, 0x68, 0xbd, 0x44, 0xd1, 0x1e, 0x08, 0xa3, 0x41, 0x29, 0xe5, 0x62, 0x32, 0x24, 0x3b,
+};
+
+static const uint8_t rs_gen_17[17] = {
+	0x77, 0x42, 0x53, 0x78, 0x77, 0x16, 0xc5, 0x53, 0xf9, 0x29, 0x8f, 0x86, 0x55, 0x35, 0x7d, 0x63,
+	0x4f,
+};
+
+static const uint8_t rs_gen_18[18] = {
+	0xef, 0xfb, 0xb7, 0x71, 0x95, 0xaf, 0xc7, 0xd7, 0xf0, 0xdc, 0x49, 0x52, 0xad, 0x4b, 0x20, 0x43,
+	0xd9, 0x92,
+};
+
+static const uint8_t rs_gen_20[20] = {
+	0x98, 0xb9, 0xf0, 0x05, 0x6f, 0x63, 0x06, 0xdc, 0x70, 0x96, 0x45, 0x24, 0xbb, 0x16, 0xe4, 0xc6,
+	0x79, 0x79, 0xa5, 0xae,
+};
+
+static const uint8_t rs_gen_22[22] = {
+	0x59, 0xb3, 0x83, 0xb0, 0xb6, 0xf4, 0x13, 0xbd, 0x45, 0x28, 0x1c, 0x89, 0x1d, 0x7b, 0x43, 0xfd,
+	0x56, 0xda, 0xe6, 0x1a, 0x91, 0xf5,
+};
+
+static const uint8_t rs_gen_26[26] = {
+	0xf6, 0x33, 0xb7, 0x04, 0x88, 0x62, 0xc7, 0x98, 0x4d, 0x38, 0xce, 0x18, 0x91, 0x28, 0xd1, 0x75,
+	0xe9, 0x2a, 0x87, 0x44, 0x46, 0x90, 0x92, 0x4d, 0x2b, 0x5e,
+};
+
+static const uint8_t rs_gen_28[28] = {
+	0xfc, 0x09, 0x1c, 0x0d, 0x12, 0xfb, 0xd0, 0x96, 0x67, 0xae, 0x64, 0x29, 0xa7, 0x0c, 0xf7, 0x38,
+	0x75, 0x77, 0xe9, 0x7f, 0xb5, 0x64, 0x79, 0x93, 0xb0, 0x4a, 0x3a, 0xc5,
+};
+
+static const uint16_t format_bits[4][8] = {
+	{ 0x77c4, 0x72f3, 0x7daa, 0x789d, 0x662f, 0x6318, 0x6c41, 0x6976 },
+	{ 0x5412, 0x5125, 0x5e7c, 0x5b4b, 0x45f9, 0x40ce, 0x4f97, 0x4aa0 },
+	{ 0x355f, 0x3068, 0x3f31, 0x3a06, 0x24b4, 0x2183, 0x2eda, 0x2bed },
+	{ 0x1689, 0x13be, 0x1ce7, 0x19d0, 0x0762, 0x0255, 0x0d0c, 0x083b },
+};
+
+/* Indexed by version - 1 and level (L, M, Q, H) */
+static const uint8_t ec_len[QRF_MAX_VERSION][4] = {
+	{ 7, 10, 13, 17 },
+	{ 10, 16, 22, 28 },
+	{ 15, 26, 18, 22 },
+	{ 20, 18, 26, 16 },
+};
+
+static const uint8_t ec_blocks[QRF_MAX_VERSION][4] = {
+	{ 1, 1, 1, 1 },
+	{ 1, 1, 1, 1 },
+	{ 1, 1, 2, 2 },
+	{ 1, 2, 2, 4 },
+};
+
+static const uint8_t total_codewords[QRF_MAX_VERSION] = { 26, 44, 70, 100 };
+
+static const uint8_t *
+rs_generator(int n)
+{
+	switch (n) {
+	case 7 :
+		return rs_gen_7;
+	case 10 :
+		return rs_gen_10;
+	case 13 :
+		return rs_gen_13;
+	case 15 :
+		return rs_gen_15;
+	case 16 :
+		return rs_gen_16;
+	case 17 :
+		return rs_gen_17;
+	case 18 :
+		return rs_gen_18;
+	case 20 :
+		return rs_gen_20;
+	case 22 :
+		return rs_gen_22;
+	case 26 :
+		return rs_gen_26;
+	default :
+		return rs_gen_28;
+	}
+}
+
+static inline uint8_t
+gf_mul(uint8_t a, uint8_t b)
+{
+	return ((a == 0) || (b == 0)) ? 0 : gf_exp[gf_log[a] + gf_log[b]];
+}
+
+static inline void
+set_func(struct qrf_code *q, int x, int y, int dark)
+{
+	q->data[y * q->width + x] = FUNC | ((dark) ? DARK : 0);
+}
+
+/* A finder pattern centered on x, y with its separator */
+static void
+draw_finder(struct qrf_code *q, int x, int y)
+{
+	int	dx, dy, d, xx, yy;
+
+	for (dy = -4; dy <= 4; dy++) {
+		for (dx = -4; dx <= 4; dx++) {
+			xx = x + dx;
+			yy = y + dy;
+			if ((xx < 0) || (xx >= q->width) || (yy < 0) || (yy >= q->width)) {
+				continue;
+			}
+			d = (abs(dx) > abs(dy)) ? abs(dx) : abs(dy);
+			set_func(q, xx, yy, (d != 2) && (d != 4));
+		}
+	}
+}
+
+static void
+draw_format(struct qrf_code *q, int mask)
+{
+	uint16_t	bits = format_bits[q->level][mask];
+	int			i, w = q->width;
+
+	for (i = 0; i <= 5; i++) {
+		set_func(q, 8, i, (bits >> i) & 1);
+	}
+	set_func(q, 8, 7, (bits >> 6) & 1);
+	set_func(q, 8, 8, (bits >> 7) & 1);
+	set_func(q, 7, 8, (bits >> 8) & 1);
+	for (i = 9; i < 15; i++) {
+		set_func(q, 14 - i, 8, (bits >> i) & 1);
+	}
+	for (i = 0; i < 8; i++) {
+		set_func(q, w - 1 - i, 8, (bits >> i) & 1);
+	}
+	for (i = 8; i < 15; i++) {
+		set_func(q, 8, w - 15 + i, (bits >> i) & 1);
+	}
+	/* and the one that is always dark */
+	set_func(q, 8, w - 8, 1);
+}
+
+static int
+mask_bit(int mask, int x, int y)
+{
+	switch (mask) {
+	case 0 :
+		return ((x + y) % 2) == 0;
+	case 1 :
+		return (y % 2) == 0;
+	case 2 :
+		return (x % 3) == 0;
+	case 3 :
+		return ((x + y) % 3) == 0;
+	case 4 :
+		return ((x / 3 + y / 2) % 2) == 0;
+	case 5 :
+		return ((x * y % 2) + (x * y % 3)) == 0;
+	case 6 :
+		return (((x * y % 2) + (x * y % 3)) % 2) == 0;
+	default :
+		return ((((x + y) % 2) + (x * y % 3)) % 2) == 0;
+	}
+}
+
+/* Invert the data modules (including the remainder bits) under 'mask' */
+static void
+apply_mask(struct qrf_code *q, int mask)
+{
+	int	x, y;
+	uint8_t	*p = q->data;
+
+	for (y = 0; y < q->width; y++) {
+		for (x = 0; x < q->width; x++, p++) {
+			if ((*p & DATA) && mask_bit(mask, x, y)) {
+				*p ^= DARK;
+			}
+		}
+	}
+}
+
+/*
+ * The standard penalty score: runs of five or more, 2 x 2 blocks,
+ * things that look like finder patterns, and the dark/light balance.
+ */
+static int
+penalty(struct qrf_code *q)
+{
+	int			w = q->width;
+	int			x, y, i, run, c, dark, score;
+	uint32_t	hbits, vbits;
+
+	score = dark = 0;
+	for (i = 0; i < w; i++) {
+		/* row and column i, runs and finder lookalikes */
+		hbits = vbits = 0;
+		for (run = 0, x = 0; x < w; x++) {
+			c = q->data[i * w + x] & DARK;
+			dark += c;
+			run = ((x > 0) && (c == (q->data[i * w + x - 1] & DARK))) ? run + 1 : 1;
+			if (run == 5) {
+				score += 3;
+			} else if (run > 5) {
+				score++;
+			}
+			hbits = ((hbits << 1) | c) & 0x7ff;
+			if ((x >= 10) && ((hbits == 0x5d0) || (hbits == 0x05d))) {
+				score += 40;
+			}
+		}
+		for (run = 0, y = 0; y < w; y++) {
+			c = q->data[y * w + i] & DARK;
+			run = ((y > 0) && (c == (q->data[(y - 1) * w + i] & DARK))) ? run + 1 : 1;
+			if (run == 5) {
+				score += 3;
+			} else if (run > 5) {
+				score++;
+			}
+			vbits = ((vbits << 1) | c) & 0x7ff;
+			if ((y >= 10) && ((vbits == 0x5d0) || (vbits == 0x05d))) {
+				score += 40;
+			}
+		}
+	}
+	for (y = 0; y < w - 1; y++) {
+		for (x = 0; x < w - 1; x++) {
+			c = q->data[y * w + x] & DARK;
+			if ((c == (q->data[y * w + x + 1] & DARK)) &&
+				(c == (q->data[(y + 1) * w + x] & DARK)) &&
+				(c == (q->data[(y + 1) * w + x + 1] & DARK))) {
+				score += 3;
+			}
+		}
+	}
+	score += 10 * (abs(dark * 20 - w * w * 10) / (w * w));
+	return score;
+}
+
+/* Draw codeword number 'n' (in the interleaved order) */
+static inline void
+place(struct qrf_code *q, int n, uint8_t v)
+{
+	const uint16_t	*p = &q->bitpos[n * 8];
+	int				i;
+
+	for (i = 0; i < 8; i++) {
+		q->data[p[i] & ~MASKED] = DATA | (((v >> (7 - i)) & 1) ^ (p[i] >> 15));
+	}
+}
+
+/*
+ * Set up for strings of 'len' characters at error correction 'level',
+ * in the smallest version they fit. Returns -1 if they don't fit in
+ * a version 4 code.
+ */
+int
+qrf_setup(struct qrf_code *q, int level, int len)
+{
+	int		v, k, x, y, i, j, e, n, right, vert, upward;
+	uint8_t	*cur, *prev;
+
+	if ((level < QRF_LEVEL_L) || (level > QRF_LEVEL_H) || (len < 1)) {
+		return -1;
+	}
+	/* mode (4 bits), count (8 bits) then the bytes */
+	for (v = 1; v <= QRF_MAX_VERSION; v++) {
+		k = total_codewords[v - 1] - ec_len[v - 1][level] * ec_blocks[v - 1][level];
+		if (12 + 8 * len <= k * 8) {
+			break;
+		}
+	}
+	if (v > QRF_MAX_VERSION) {
+		return -1;
+	}
+	q->level = level;
+	q->len = len;
+	q->version = v;
+	q->width = 17 + 4 * v;
+	q->mask = -1;
+	q->blocks = ec_blocks[v - 1][level];
+	q->data_len = k / q->blocks;
+	q->ec_len = ec_len[v - 1][level];
+	q->gen = rs_generator(q->ec_len);
+	q->full = q->partial = q->changed = 0;
+
+	/* function patterns, and the format areas reserved */
+	memset(q->data, 0, sizeof(q->data));
+	draw_finder(q, 3, 3);
+	draw_finder(q, q->width - 4, 3);
+	draw_finder(q, 3, q->width - 4);
+	for (i = 8; i < q->width - 8; i++) {
+		set_func(q, i, 6, (i % 2) == 0);
+		set_func(q, 6, i, (i % 2) == 0);
+	}
+	if (v > 1) {
+		for (y = -2; y <= 2; y++) {
+			for (x = -2; x <= 2; x++) {
+				set_func(q, q->width - 7 + x, q->width - 7 + y,
+					(abs(x) == 2) || (abs(y) == 2) || ((x == 0) && (y == 0)));
+			}
+		}
+	}
+	draw_format(q, 0);
+
+	/* the zig zag path of the codeword bits through everything else */
+	n = 0;
+	for (right = q->width - 1; right >= 1; right -= 2) {
+		if (right == 6) {
+			right = 5;
+		}
+		upward = ((right + 1) & 2) == 0;
+		for (vert = 0; vert < q->width; vert++) {
+			y = (upward) ? q->width - 1 - vert : vert;
+			for (j = 0; j < 2; j++) {
+				x = right - j;
+				if (q->data[y * q->width + x] & FUNC) {
+					continue;
+				}
+				/* anything past the last codeword is a remainder bit */
+				q->data[y * q->width + x] = DATA;
+				if (n < total_codewords[v - 1] * 8) {
+					q->bitpos[n++] = y * q->width + x;
+				}
+			}
+		}
+	}
+
+	/*
+	 * The EC codewords a lone 1 at each data position would give, the
+	 * last position gives the generator itself and each one before is
+	 * that pushed through the division once more.
+	 */
+	e = q->ec_len;
+	memcpy(&q->vec[(q->data_len - 1) * e], q->gen, e);
+	for (j = q->data_len - 2; j >= 0; j--) {
+		prev = &q->vec[(j + 1) * e];
+		cur = &q->vec[j * e];
+		for (i = 0; i < e - 1; i++) {
+			cur[i] = prev[i + 1] ^ gf_mul(q->gen[i], prev[0]);
+		}
+		cur[e - 1] = gf_mul(q->gen[e - 1], prev[0]);
+	}
+	return 0;
+}
+
+/* The data codewords for 's', header, characters, terminator and padding */
+static void
+build_codewords(struct qrf_code *q, const char *s, uint8_t *out)
+{
+	int		i, n;
+
+	n = q->data_len * q->blocks;
+	out[0] = 0x40 | (q->len >> 4);
+	out[1] = (q->len << 4) | ((uint8_t) s[0] >> 4);
+	for (i = 1; i < q->len; i++) {
+		out[i + 1] = ((uint8_t) s[i - 1] << 4) | ((uint8_t) s[i] >> 4);
+	}
+	/* the low 4 bits are the terminator */
+	out[q->len + 1] = (uint8_t) s[q->len - 1] << 4;
+	for (i = q->len + 2; i < n; i++) {
+		out[i] = ((i - q->len) & 1) ? 0x11 : 0xec;
+	}
+}
+
+/* Everything from scratch, then pick the mask */
+static void
+encode_full(struct qrf_code *q)
+{
+	int		b, i, j, m, p, best, score;
+	int		n = q->data_len * q->blocks;
+	uint8_t	factor, *ec;
+
+	for (b = 0; b < q->blocks; b++) {
+		ec = q->ec[b];
+		memset(ec, 0, q->ec_len);
+		for (i = 0; i < q->data_len; i++) {
+			factor = q->code[b * q->data_len + i] ^ ec[0];
+			for (j = 0; j < q->ec_len - 1; j++) {
+				ec[j] = ec[j + 1] ^ gf_mul(q->gen[j], factor);
+			}
+			ec[q->ec_len - 1] = gf_mul(q->gen[q->ec_len - 1], factor);
+		}
+	}
+	for (i = 0; i < n; i++) {
+		place(q, (i % q->data_len) * q->blocks + (i / q->data_len), q->code[i]);
+	}
+	for (b = 0; b < q->blocks; b++) {
+		for (j = 0; j < q->ec_len; j++) {
+			place(q, n + j * q->blocks + b, q->ec[b][j]);
+		}
+	}
+
+	best = 0;
+	score = 0x7fffffff;
+	for (m = 0; m < 8; m++) {
+		apply_mask(q, m);
+		draw_format(q, m);
+		p = penalty(q);
+		if (p < score) {
+			score = p;
+			best = m;
+		}
+		apply_mask(q, m);
+	}
+	/* from now on place() masks the bits as it draws them */
+	q->mask = best;
+	for (i = 0; i < total_codewords[q->version - 1] * 8; i++) {
+		p = q->bitpos[i];
+		if (mask_bit(best, p % q->width, p / q->width)) {
+			q->bitpos[i] |= MASKED;
+		}
+	}
+	apply_mask(q, best);
+	draw_format(q, best);
+	q->full++;
+}
+
+/*
+ * Encode 's', which has to be the length given to qrf_setup(). The
+ * result is in q->data. Returns the number of codewords that had to be
+ * redrawn, or -1 if the length is wrong.
+ */
+int
+qrf_encode(struct qrf_code *q, const char *s)
+{
+	uint8_t		code[QRF_MAX_DATA];
+	const uint8_t	*v;
+	uint8_t		delta, *ec;
+	int			i, j, b, e, n, dirty, count;
+
+	if ((int) strlen(s) != q->len) {
+		return -1;
+	}
+	n = q->data_len * q->blocks;
+	if (q->mask < 0) {
+		build_codewords(q, s, q->code);
+		encode_full(q);
+		return total_codewords[q->version - 1];
+	}
+
+	build_codewords(q, s, code);
+	dirty = count = 0;
+	for (i = 0; i < n; i++) {
+		if (code[i] == q->code[i]) {
+			continue;
+		}
+		b = i / q->data_len;
+		j = i % q->data_len;
+		delta = code[i] ^ q->code[i];
+		v = &q->vec[j * q->ec_len];
+		ec = q->ec[b];
+		for (e = 0; e < q->ec_len; e++) {
+			if (v[e]) {
+				ec[e] ^= gf_exp[gf_log[delta] + gf_log[v[e]]];
+			}
+		}
+		q->code[i] = code[i];
+		place(q, j * q->blocks + b, code[i]);
+		dirty |= 1 << b;
+		count++;
+	}
+	for (b = 0; b < q->blocks; b++) {
+		if (dirty & (1 << b)) {
+			for (j = 0; j < q->ec_len; j++) {
+				place(q, n + j * q->blocks + b, q->ec[b][j]);
+			}
+			count += q->ec_len;
+		}
+	}
+	q->partial++;
+	q->changed += count;
+	return count;
+}
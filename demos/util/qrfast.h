@@ -0,0 +1,54 @@
+/*
+ * qrfast.h
+ *
+ * A QR encoder for the clock demos. It only does what the clocks need,
+ * one 8 bit string of a fixed length in a version 1 - 4 code, but it
+ * does it without allocating anything and, when only a few characters
+ * change from one call to the next (the seconds of a time stamp), it
+ * only redoes the modules that those characters affect.
+ *
+ * The output is laid out like libqrencode's QRcode data, a byte per
+ * module with bit 0 set for dark modules, bit 1 set for data and error
+ * correction modules and bit 7 for everything else.
+ */
+#ifndef __QRFAST_H
+#define __QRFAST_H
+
+#define QRF_MAX_VERSION		4
+#define QRF_MAX_WIDTH		(17 + 4 * QRF_MAX_VERSION)
+#define QRF_MAX_CODEWORDS	100		/* version 4 */
+#define QRF_MAX_DATA		80		/* version 4-L */
+#define QRF_MAX_EC			28		/* per block, version 2-H */
+#define QRF_MAX_BLOCKS		4
+#define QRF_MAX_VECTORS		1600	/* data bytes per block * EC, 4-L */
+
+/* Error correction levels, in the same order as libqrencode's QRecLevel */
+#define QRF_LEVEL_L		0
+#define QRF_LEVEL_M		1
+#define QRF_LEVEL_Q		2
+#define QRF_LEVEL_H		3
+
+struct qrf_code {
+	int			level;
+	int			len;				/* string length it is set up for */
+	int			version;
+	int			width;
+	int			mask;				/* -1 until the first encode picks one */
+	int			blocks;
+	int			data_len;			/* data codewords per block */
+	int			ec_len;				/* EC codewords per block */
+	const uint8_t *gen;				/* RS generator polynomial */
+	uint8_t		code[QRF_MAX_DATA];	/* data codewords, block after block */
+	uint8_t		ec[QRF_MAX_BLOCKS][QRF_MAX_EC];
+	uint8_t		vec[QRF_MAX_VECTORS];	/* EC of a 1 at each data position */
+	uint16_t	bitpos[QRF_MAX_CODEWORDS * 8];	/* module of each bit, | mask */
+	uint32_t	full;				/* encodes from scratch */
+	uint32_t	partial;			/* and incremental ones */
+	uint32_t	changed;			/* codewords redone by those */
+	uint8_t		data[QRF_MAX_WIDTH * QRF_MAX_WIDTH];
+};
+
+int qrf_setup(struct qrf_code *q, int level, int len);
+int qrf_encode(struct qrf_code *q, const char *s);
+
+#endif /* generic header protector */
@@ -39,6 +39,7 @@ void null_init(void);
 #pragma weak sdram_init = null_init
 #pragma weak qspi_init = null_init
 #pragma weak lcd_init = null_init
+#pragma weak defer_setup = null_init
 
 static void SystemInit(void);
 
@@ -132,6 +133,7 @@ __attribute__((constructor))
 static void SystemInit()
 {
 	clock_setup();
+	defer_setup();
 	/* Sadly the "virtual" COM port that ST provides
 	 * on the ST-Link is unable to keep up at 115,200
 	 */
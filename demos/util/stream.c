@@ -0,0 +1,600 @@
+/*
+ * stream.c -- frames streamed from a host over the console USART
+ *
+ * stream_run() takes the console USART over and shows whatever frames
+ * the host sends, until it sends STREAM_END. The bytes are moved by
+ * DMA (USART3 RX is DMA1 stream 1 channel 4, TX is stream 3 channel
+ * 4). The payload of a frame goes straight into the frame buffer being
+ * drawn, packed formats are DMA'd into the end of it and unpacked in
+ * place from the front (every format is at most 2 bytes a pixel, so
+ * the unpacking never catches up with what it hasn't read yet), RGB565
+ * needs nothing done to it at all. Deltas (changes to the last frame)
+ * are received into a buffer of their own and applied to a copy of the
+ * last frame in the one being drawn.
+ *
+ * The header and the payload are separate transfers and the host
+ * sends them back to back, so the next transfer is started from the
+ * DMA interrupt, at the console's priority, rather than by polling
+ * which the panel interrupts could hold up for longer than a byte.
+ * Everything else (checking, unpacking, the reply) happens in
+ * stream_run() itself.
+ *
+ * A header that doesn't check out is hunted through for the next
+ * magic number, and a message that stops part way is dropped after
+ * STREAM_TIMEOUT mS, so the stream picks itself up after lost bytes.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/usart.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
+#include "../util/util.h"
+#include "../util/hub75.h"
+#include "../util/stream.h"
+
+/* The console USART (see console.c) and its DMA streams */
+#define STREAM_USART		USART3
+#define STREAM_DMA			DMA1
+#define STREAM_DMA_RX		DMA_STREAM1
+#define STREAM_DMA_TX		DMA_STREAM3
+#define STREAM_DMA_CHANNEL	DMA_SxCR_CHSEL_4
+#define STREAM_DMA_FLAGS	(DMA_TCIF | DMA_HTIF | DMA_TEIF | DMA_DMEIF | DMA_FEIF)
+#define STREAM_CONSOLE_BAUD	115200		/* what retarget.c sets up */
+
+#define RX_HDR		0		/* waiting for (the rest of) a header */
+#define RX_DATA		1		/* waiting for the payload */
+#define RX_DONE		2		/* a whole message, for stream_run() */
+
+static const struct stream_panel *panel;
+static struct stream_hdr rx_hdr;
+static volatile int rx_state;
+static int rx_discard;				/* the payload had nowhere to go */
+static uint8_t rx_sink;
+static uint32_t rx_arg;				/* small payloads (the baud rate) */
+static uint32_t resyncs;
+static const uint16_t *last_frame;	/* the frame deltas are applied to */
+
+static uint16_t rgb332[256];
+
+uint16_t
+stream_fletcher(const uint8_t *p, int len)
+{
+	uint32_t	a = 0, b = 0;
+	int			n;
+
+	/* 256 bytes can't overflow the sums before they are reduced */
+	while (len > 0) {
+		n = (len > 256) ? 256 : len;
+		len -= n;
+		do {
+			a += *p++;
+			b += a;
+		} while (--n);
+		a %= 255;
+		b %= 255;
+	}
+	return (uint16_t) ((b << 8) | a);
+}
+
+/* Bytes in 'n' pixels of 'format', 0 if there's no such format */
+int
+stream_frame_bytes(int n, int format)
+{
+	switch (format) {
+	case STREAM_RGB111 :
+		return n / 2;
+	case STREAM_RGB332 :
+		return n;
+	case STREAM_RGB444 :
+		return (n * 3) / 2;
+	case STREAM_RGB565 :
+		return n * 2;
+	default :
+		return 0;
+	}
+}
+
+/* Bytes in a frame of 'format' */
+static int
+frame_bytes(int format)
+{
+	return stream_frame_bytes(panel->width * panel->height, format);
+}
+
+/* Start receiving 'len' bytes into 'buf', or into the sink if it's NULL */
+static void
+rx_start(void *buf, int len)
+{
+	dma_disable_stream(STREAM_DMA, STREAM_DMA_RX);
+	while (DMA_SCR(STREAM_DMA, STREAM_DMA_RX) & DMA_SxCR_EN) ;
+	dma_clear_interrupt_flags(STREAM_DMA, STREAM_DMA_RX, STREAM_DMA_FLAGS);
+	if (buf != NULL) {
+		dma_enable_memory_increment_mode(STREAM_DMA, STREAM_DMA_RX);
+	} else {
+		dma_disable_memory_increment_mode(STREAM_DMA, STREAM_DMA_RX);
+		buf = &rx_sink;
+	}
+	dma_set_memory_address(STREAM_DMA, STREAM_DMA_RX, (uint32_t) buf);
+	dma_set_number_of_data(STREAM_DMA, STREAM_DMA_RX, len);
+	dma_enable_stream(STREAM_DMA, STREAM_DMA_RX);
+}
+
+/* Send 'len' bytes and wait until they have gone */
+static void
+tx_send(const void *buf, int len)
+{
+	dma_disable_stream(STREAM_DMA, STREAM_DMA_TX);
+	while (DMA_SCR(STREAM_DMA, STREAM_DMA_TX) & DMA_SxCR_EN) ;
+	dma_clear_interrupt_flags(STREAM_DMA, STREAM_DMA_TX, STREAM_DMA_FLAGS);
+	dma_set_memory_address(STREAM_DMA, STREAM_DMA_TX, (uint32_t) buf);
+	dma_set_number_of_data(STREAM_DMA, STREAM_DMA_TX, len);
+	dma_enable_stream(STREAM_DMA, STREAM_DMA_TX);
+	while (! dma_get_interrupt_flag(STREAM_DMA, STREAM_DMA_TX, DMA_TCIF)) ;
+	while ((USART_SR(STREAM_USART) & USART_SR_TC) == 0) ;
+}
+
+static void
+rx_header(void)
+{
+	rx_state = RX_HDR;
+	rx_start(&rx_hdr, sizeof(rx_hdr));
+}
+
+/*
+ * Where the payload of the message in rx_hdr goes, NULL if it can't
+ * be taken (it is still received, and thrown away).
+ */
+static void *
+payload_dest(void)
+{
+	int	n;
+
+	switch (rx_hdr.type) {
+	case STREAM_FRAME :
+		n = frame_bytes(rx_hdr.format);
+		if ((n == 0) || (rx_hdr.len != n)) {
+			return NULL;
+		}
+		return (uint8_t *) *panel->draw + frame_bytes(STREAM_RGB565) - n;
+	case STREAM_DELTA :
+		return (rx_hdr.len <= STREAM_DELTA_MAX) ? panel->buf : NULL;
+	case STREAM_BAUD :
+		return (rx_hdr.len == sizeof(rx_arg)) ? &rx_arg : NULL;
+	default :
+		return NULL;
+	}
+}
+
+/*
+ * A transfer finished. After a good header start on its payload right
+ * away, the host is already sending it.
+ */
+void
+dma1_stream1_isr(void)
+{
+	uint8_t	*b = (uint8_t *) &rx_hdr;
+	void	*dst;
+	int		i;
+
+	if (! dma_get_interrupt_flag(STREAM_DMA, STREAM_DMA_RX, DMA_TCIF)) {
+		dma_clear_interrupt_flags(STREAM_DMA, STREAM_DMA_RX, STREAM_DMA_FLAGS);
+		return;
+	}
+	dma_clear_interrupt_flags(STREAM_DMA, STREAM_DMA_RX, DMA_TCIF);
+	if (rx_state != RX_HDR) {
+		rx_state = RX_DONE;
+		return;
+	}
+
+	if ((b[0] == STREAM_MAGIC0) && (b[1] == STREAM_MAGIC1) &&
+		(stream_fletcher(b, offsetof(struct stream_hdr, check)) == rx_hdr.check)) {
+		if (rx_hdr.len == 0) {
+			rx_discard = 0;
+			rx_state = RX_DONE;
+			return;
+		}
+		dst = payload_dest();
+		rx_discard = (dst == NULL);
+		rx_state = RX_DATA;
+		rx_start(dst, rx_hdr.len);
+		return;
+	}
+
+	/* keep anything from the next magic number on and read the rest */
+	resyncs++;
+	for (i = 1; i < (int) sizeof(rx_hdr); i++) {
+		if ((b[i] == STREAM_MAGIC0) &&
+			((i == sizeof(rx_hdr) - 1) || (b[i + 1] == STREAM_MAGIC1))) {
+			break;
+		}
+	}
+	memmove(b, b + i, sizeof(rx_hdr) - i);
+	rx_start(b + sizeof(rx_hdr) - i, i);
+}
+
+/* 4 bit channels to RGB565, the top bits repeated into the bottom ones */
+static uint16_t
+rgb444(int r, int g, int b)
+{
+	return (uint16_t) ((((r << 1) | (r >> 3)) << 11) |
+					(((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3)));
+}
+
+/*
+ * Unpack 'n' pixels that were received into the end of the frame
+ * buffer, front to back, so each pixel is written after the bytes it
+ * came from have been read.
+ */
+void
+stream_unpack(uint16_t *fb, int n, int format)
+{
+	const uint8_t	*src;
+	int				i;
+	uint8_t			b0, b1, b2;
+
+	if (rgb332[0xff] == 0) {
+		for (i = 0; i < 256; i++) {
+			rgb332[i] = RGB565((i >> 5) * 255 / 7, ((i >> 2) & 7) * 255 / 7,
+								(i & 3) * 255 / 3);
+		}
+	}
+	src = (const uint8_t *) fb + stream_frame_bytes(n, STREAM_RGB565) -
+			stream_frame_bytes(n, format);
+	switch (format) {
+	case STREAM_RGB111 :
+		for (i = 0; i < n; i += 2) {
+			b0 = *src++;
+			fb[i] = hub75_colors[b0 & 7];
+			fb[i + 1] = hub75_colors[(b0 >> 4) & 7];
+		}
+		break;
+	case STREAM_RGB332 :
+		for (i = 0; i < n; i++) {
+			fb[i] = rgb332[*src++];
+		}
+		break;
+	case STREAM_RGB444 :
+		for (i = 0; i < n; i += 2) {
+			b0 = *src++;
+			b1 = *src++;
+			b2 = *src++;
+			fb[i] = rgb444(b0 >> 4, b0 & 0xf, b1 >> 4);
+			fb[i + 1] = rgb444(b1 & 0xf, b2 >> 4, b2 & 0xf);
+		}
+		break;
+	default :
+		/* RGB565 arrived where it belongs */
+		break;
+	}
+}
+
+/*
+ * Start the frame being drawn as a copy of the last one, the rows that
+ * weren't the same already are marked dirty.
+ */
+static void
+copy_last(uint16_t *fb)
+{
+	int	y, w = panel->width;
+
+	for (y = 0; y < panel->height; y++) {
+		if (memcmp(fb + y * w, last_frame + y * w, w * sizeof(uint16_t)) != 0) {
+			memcpy(fb + y * w, last_frame + y * w, w * sizeof(uint16_t));
+			hub75_dirty(y);
+		}
+	}
+}
+
+/*
+ * Apply a delta (see stream.h) to the frame, marking the rows it
+ * changes. Returns -1 if it runs off the end of its rectangle or the
+ * payload, and the frame is left half done.
+ */
+static int
+delta_apply(uint16_t *fb, const uint8_t *p, int len)
+{
+	const uint8_t	*end = p + len;
+	uint16_t		*row;
+	uint16_t		v = 0;
+	int				op, n;
+	int				rx = 0, ry = 0, rw = panel->width, rh = panel->height;
+	int				x = 0, y = 0;
+
+	row = fb;
+	while (p < end) {
+		op = *p & DELTA_OP;
+		n = (*p++ & DELTA_COUNT) + 1;
+		if (op == DELTA_RECT) {
+			if ((n != 1) || (end - p < 4)) {
+				return -1;
+			}
+			rx = p[0];
+			ry = p[1];
+			rw = p[2] + 1;
+			rh = p[3] + 1;
+			p += 4;
+			if ((rx + rw > panel->width) || (ry + rh > panel->height)) {
+				return -1;
+			}
+			x = y = 0;
+			row = fb + ry * panel->width + rx;
+			continue;
+		}
+		if (op == DELTA_SKIP) {
+			x += n;
+			y += x / rw;
+			row += (x / rw) * panel->width;
+			x %= rw;
+			if ((y > rh) || ((y == rh) && (x != 0))) {
+				return -1;
+			}
+			continue;
+		}
+		if (op == DELTA_RUN) {
+			if (end - p < 2) {
+				return -1;
+			}
+			v = p[0] | (p[1] << 8);
+			p += 2;
+		} else if (end - p < 2 * n) {
+			return -1;
+		}
+		if (y >= rh) {
+			return -1;
+		}
+		hub75_dirty(ry + y);
+		while (n--) {
+			if (y >= rh) {
+				return -1;
+			}
+			if (op == DELTA_COPY) {
+				v = p[0] | (p[1] << 8);
+				p += 2;
+			}
+			row[x] ^= v;
+			if (++x == rw) {
+				x = 0;
+				row += panel->width;
+				if (++y < rh) {
+					hub75_dirty(ry + y);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static void
+stream_setup(void)
+{
+	/* let the console finish, then stop it reading */
+	while ((USART_SR(STREAM_USART) & USART_SR_TC) == 0) ;
+	usart_disable_rx_interrupt(STREAM_USART);
+	while (console_getc(0) != 0) ;
+
+	rcc_periph_clock_enable(RCC_DMA1);
+	dma_stream_reset(STREAM_DMA, STREAM_DMA_RX);
+	dma_channel_select(STREAM_DMA, STREAM_DMA_RX, STREAM_DMA_CHANNEL);
+	dma_set_priority(STREAM_DMA, STREAM_DMA_RX, DMA_SxCR_PL_HIGH);
+	dma_set_memory_size(STREAM_DMA, STREAM_DMA_RX, DMA_SxCR_MSIZE_8BIT);
+	dma_set_peripheral_size(STREAM_DMA, STREAM_DMA_RX, DMA_SxCR_PSIZE_8BIT);
+	dma_set_transfer_mode(STREAM_DMA, STREAM_DMA_RX, DMA_SxCR_DIR_PERIPHERAL_TO_MEM);
+	dma_set_peripheral_address(STREAM_DMA, STREAM_DMA_RX,
+								(uint32_t) &USART_DR(STREAM_USART));
+	dma_enable_transfer_complete_interrupt(STREAM_DMA, STREAM_DMA_RX);
+
+	dma_stream_reset(STREAM_DMA, STREAM_DMA_TX);
+	dma_channel_select(STREAM_DMA, STREAM_DMA_TX, STREAM_DMA_CHANNEL);
+	dma_set_priority(STREAM_DMA, STREAM_DMA_TX, DMA_SxCR_PL_HIGH);
+	dma_set_memory_size(STREAM_DMA, STREAM_DMA_TX, DMA_SxCR_MSIZE_8BIT);
+	dma_set_peripheral_size(STREAM_DMA, STREAM_DMA_TX, DMA_SxCR_PSIZE_8BIT);
+	dma_enable_memory_increment_mode(STREAM_DMA, STREAM_DMA_TX);
+	dma_set_transfer_mode(STREAM_DMA, STREAM_DMA_TX, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+	dma_set_peripheral_address(STREAM_DMA, STREAM_DMA_TX,
+								(uint32_t) &USART_DR(STREAM_USART));
+
+	nvic_set_priority(NVIC_DMA1_STREAM1_IRQ, IRQ_PRI_CONSOLE);
+	nvic_enable_irq(NVIC_DMA1_STREAM1_IRQ);
+	usart_enable_rx_dma(STREAM_USART);
+	usart_enable_tx_dma(STREAM_USART);
+	(void) USART_SR(STREAM_USART);
+	(void) USART_DR(STREAM_USART);
+}
+
+static void
+stream_teardown(int baud)
+{
+	nvic_disable_irq(NVIC_DMA1_STREAM1_IRQ);
+	dma_disable_stream(STREAM_DMA, STREAM_DMA_RX);
+	dma_disable_stream(STREAM_DMA, STREAM_DMA_TX);
+	usart_disable_rx_dma(STREAM_USART);
+	usart_disable_tx_dma(STREAM_USART);
+	if (baud != STREAM_CONSOLE_BAUD) {
+		usart_set_baudrate(STREAM_USART, STREAM_CONSOLE_BAUD);
+	}
+	(void) USART_SR(STREAM_USART);
+	(void) USART_DR(STREAM_USART);
+	usart_enable_rx_interrupt(STREAM_USART);
+}
+
+/*
+ * Show frames from the host until it says STREAM_END. Nothing else
+ * can use the console until then (and that includes printf()).
+ */
+void
+stream_run(const struct stream_panel *p, struct stream_stats *st)
+{
+	struct stream_hdr	hdr, reply;
+	const void			*payload;
+	uint32_t			start, cycles, mask;
+	uint32_t			baud, new_baud, last;
+	uint16_t			left, was;
+	int					y, fin;
+
+	panel = p;
+	memset(st, 0, sizeof(*st));
+	resyncs = 0;
+	baud = STREAM_CONSOLE_BAUD;
+	last_frame = *panel->display;
+	stream_setup();
+	rx_header();
+	fin = 0;
+	was = sizeof(rx_hdr);
+	last = mtime();
+
+	while (! fin) {
+		if (rx_state != RX_DONE) {
+			/* drop a message that stops arriving part way through */
+			left = dma_get_number_of_data(STREAM_DMA, STREAM_DMA_RX);
+			if ((left != was) || ((rx_state == RX_HDR) && (left == sizeof(rx_hdr)))) {
+				was = left;
+				last = mtime();
+			} else if (mtime() - last > STREAM_TIMEOUT) {
+				mask = cm_mask_interrupts(1);
+				if (rx_state != RX_DONE) {
+					rx_header();
+					st->timeouts++;
+				}
+				cm_mask_interrupts(mask);
+			}
+			continue;
+		}
+
+		hdr = rx_hdr;
+		st->bytes += sizeof(hdr) + hdr.len;
+		reply.format = STREAM_OK;
+		reply.len = 0;
+		payload = NULL;
+		new_baud = 0;
+		switch (hdr.type) {
+		case STREAM_FRAME :
+			start = dwt_read_cycle_counter();
+			if (rx_discard) {
+				reply.format = STREAM_BAD_LEN;
+			} else if (stream_fletcher((uint8_t *) *panel->draw +
+							frame_bytes(STREAM_RGB565) - hdr.len, hdr.len) != hdr.sum) {
+				reply.format = STREAM_BAD_SUM;
+			} else {
+				stream_unpack(*panel->draw, panel->width * panel->height,
+								hdr.format);
+				/* the row hashes will sort out which really changed */
+				for (y = 0; y < panel->height; y++) {
+					hub75_dirty(y);
+				}
+				last_frame = *panel->draw;
+				panel->done();
+				st->frames++;
+			}
+			cycles = dwt_read_cycle_counter() - start;
+			st->cycles += cycles;
+			if (cycles > st->cycles_max) {
+				st->cycles_max = cycles;
+			}
+			break;
+		case STREAM_DELTA :
+			start = dwt_read_cycle_counter();
+			if (rx_discard || (hdr.format != STREAM_RGB565)) {
+				reply.format = STREAM_BAD_LEN;
+			} else if (stream_fletcher(panel->buf, hdr.len) != hdr.sum) {
+				reply.format = STREAM_BAD_SUM;
+			} else {
+				copy_last(*panel->draw);
+				if (delta_apply(*panel->draw, panel->buf, hdr.len) < 0) {
+					reply.format = STREAM_BAD_DATA;
+				} else {
+					last_frame = *panel->draw;
+					panel->done();
+					st->frames++;
+					st->deltas++;
+				}
+			}
+			cycles = dwt_read_cycle_counter() - start;
+			st->cycles += cycles;
+			if (cycles > st->cycles_max) {
+				st->cycles_max = cycles;
+			}
+			break;
+		case STREAM_SHOT :
+			payload = *panel->display;
+			reply.len = frame_bytes(STREAM_RGB565);
+			st->shots++;
+			break;
+		case STREAM_BAUD :
+			if (rx_discard || (rx_arg < 9600) || (rx_arg > STREAM_MAX_BAUD)) {
+				reply.format = STREAM_BAD_LEN;
+			} else {
+				new_baud = rx_arg;
+			}
+			break;
+		case STREAM_END :
+			fin = 1;
+			break;
+		default :
+			reply.format = STREAM_BAD_TYPE;
+			break;
+		}
+		if (reply.format != STREAM_OK) {
+			st->errors++;
+		}
+
+		/* listen for the next one before answering this one */
+		if (! fin) {
+			was = sizeof(rx_hdr);
+			last = mtime();
+			rx_header();
+		}
+		reply.magic[0] = STREAM_MAGIC0;
+		reply.magic[1] = STREAM_MAGIC1;
+		reply.type = hdr.type | STREAM_REPLY;
+		reply.seq = hdr.seq;
+		reply.sum = (payload != NULL) ? stream_fletcher(payload, reply.len) : 0;
+		reply.check = stream_fletcher((uint8_t *) &reply,
+										offsetof(struct stream_hdr, check));
+		tx_send(&reply, sizeof(reply));
+		if (payload != NULL) {
+			tx_send(payload, reply.len);
+		}
+		if (new_baud) {
+			usart_set_baudrate(STREAM_USART, new_baud);
+			baud = new_baud;
+		}
+	}
+	st->resyncs = resyncs;
+	stream_teardown(baud);
+}
+
+/*
+ * The screenshot on its own, from the console. It is the same reply
+ * the stream sends for STREAM_SHOT, written out with console_putc().
+ */
+void
+stream_shot(const struct stream_panel *p)
+{
+	struct stream_hdr	reply;
+	const uint8_t		*b;
+	int					i;
+
+	panel = p;
+	memset(&reply, 0, sizeof(reply));
+	reply.magic[0] = STREAM_MAGIC0;
+	reply.magic[1] = STREAM_MAGIC1;
+	reply.type = STREAM_SHOT | STREAM_REPLY;
+	reply.format = STREAM_OK;
+	reply.len = frame_bytes(STREAM_RGB565);
+	reply.sum = stream_fletcher((const uint8_t *) *p->display, reply.len);
+	reply.check = stream_fletcher((uint8_t *) &reply,
+									offsetof(struct stream_hdr, check));
+	b = (const uint8_t *) &reply;
+	for (i = 0; i < (int) sizeof(reply); i++) {
+		console_putc(b[i]);
+	}
+	b = (const uint8_t *) *p->display;
+	for (i = 0; i < reply.len; i++) {
+		console_putc(b[i]);
+	}
+}
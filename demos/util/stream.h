@@ -0,0 +1,105 @@
+/*
+ * stream.h
+ *
+ * Frames streamed from a host over the console USART, see stream.c
+ * and tools/hub75_stream.py on the host side.
+ *
+ * Everything on the wire is little endian. Each message starts with
+ * a 12 byte header, followed by 'len' bytes of payload. The board
+ * answers each one with a header of its own, type | STREAM_REPLY and
+ * the status in 'format', followed by any payload (the screenshot).
+ * The host waits for that answer before sending the next message.
+ */
+#ifndef __STREAM_H
+#define __STREAM_H
+
+#define STREAM_MAGIC0	'H'
+#define STREAM_MAGIC1	'S'
+
+struct stream_hdr {
+	uint8_t		magic[2];
+	uint8_t		type;			/* STREAM_FRAME ... */
+	uint8_t		format;			/* pixel format, or status in a reply */
+	uint16_t	seq;			/* copied into the reply */
+	uint16_t	len;			/* payload bytes that follow */
+	uint16_t	sum;			/* Fletcher-16 of the payload */
+	uint16_t	check;			/* Fletcher-16 of the header up to here */
+};
+
+/* message types */
+#define STREAM_FRAME	1		/* a frame buffer, in 'format' */
+#define STREAM_SHOT		2		/* send back what is on display, RGB565 */
+#define STREAM_BAUD		3		/* payload is the new baud rate (uint32_t) */
+#define STREAM_END		4		/* back to the console */
+#define STREAM_DELTA	5		/* changes to the last frame, see below */
+#define STREAM_SLICE	6		/* a board's part of a wall frame, see wall.h */
+#define STREAM_REPLY	0x80
+
+/* pixel formats, pixels in rows from the top left */
+#define STREAM_RGB111	0		/* two pixels a byte, low nibble first, 0RGB */
+#define STREAM_RGB332	1		/* a byte a pixel, RRRGGGBB */
+#define STREAM_RGB444	2		/* two pixels in 3 bytes, RG BR GB */
+#define STREAM_RGB565	3		/* the frame buffer itself */
+
+/* status in replies */
+#define STREAM_OK		0
+#define STREAM_BAD_SUM	1		/* payload checksum didn't match */
+#define STREAM_BAD_LEN	2		/* wrong size for the format, or no such format */
+#define STREAM_BAD_TYPE	3
+#define STREAM_BAD_DATA	4		/* a delta that doesn't fit the frame */
+
+/*
+ * A STREAM_DELTA payload is the new frame XORed with the last one that
+ * was shown (as RGB565, 'format' must be STREAM_RGB565), run length
+ * coded. Each code byte has an op in the top two bits and a count - 1
+ * (1 - 64 pixels) in the rest:
+ *
+ *	00 SKIP		count pixels are unchanged
+ *	01 RUN		count pixels are XORed with the next 2 bytes
+ *	10 COPY		count pixels are each XORed with the next 2 bytes
+ *	11 RECT		0xc0, then x, y, width - 1, height - 1 of a rectangle
+ *
+ * Pixels go along the rows of the current rectangle, which is the
+ * whole frame until a RECT op sets one, and those left over at the end
+ * of the payload are unchanged. Typically there is a RECT around each
+ * band of rows that changed.
+ */
+#define DELTA_SKIP		0x00
+#define DELTA_RUN		0x40
+#define DELTA_COPY		0x80
+#define DELTA_RECT		0xc0
+#define DELTA_OP		0xc0
+#define DELTA_COUNT		0x3f
+#define STREAM_DELTA_MAX	4096	/* longest delta payload, else send a frame */
+
+#define STREAM_MAX_BAUD	2625000	/* APB1 (42MHz) / 16 */
+#define STREAM_TIMEOUT	200		/* mS without a byte mid message */
+
+/* What the stream draws into, the pointers change as frames are swapped */
+struct stream_panel {
+	int			width, height;
+	uint16_t	**draw;			/* the frame being filled in */
+	uint16_t	**display;		/* the one being shown */
+	void		(*done)(void);	/* the frame in *draw is complete */
+	uint8_t		*buf;			/* STREAM_DELTA_MAX bytes for deltas */
+};
+
+struct stream_stats {
+	uint32_t	frames;			/* good frames shown */
+	uint32_t	deltas;			/* of which were sent as deltas */
+	uint32_t	errors;			/* bad checksums, sizes and types */
+	uint32_t	resyncs;		/* headers that had to be hunted for */
+	uint32_t	timeouts;		/* messages that stopped part way */
+	uint32_t	shots;
+	uint32_t	bytes;
+	uint32_t	cycles;			/* checking and unpacking frames */
+	uint32_t	cycles_max;
+};
+
+uint16_t stream_fletcher(const uint8_t *p, int len);
+int stream_frame_bytes(int n, int format);
+void stream_unpack(uint16_t *fb, int n, int format);
+void stream_run(const struct stream_panel *panel, struct stream_stats *st);
+void stream_shot(const struct stream_panel *panel);
+
+#endif /* generic header protector */
@@ -0,0 +1,198 @@
+/*
+ * ticker.c -- scrolling text that is only drawn once
+ *
+ * Each ticker is a band of frame buffer rows and a strip of the same
+ * height that is wider than the frame buffer. The text is drawn into
+ * the strip once, with the first frame buffer width of it repeated at
+ * the end so that any window onto it is contiguous, and at each frame
+ * the rows of the band are pointed at the window for the current
+ * position (hub75_row_source()). Scrolling costs a few pointer writes
+ * per frame, plus encoding the rows that changed for BCM.
+ *
+ * The position is worked out from mtime() and a speed in Q16 pixels
+ * per second, so slow speeds (less than a pixel a frame) move evenly
+ * and the speed doesn't depend on the refresh rate.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <libopencm3/cm3/cortex.h>
+#include "../util/util.h"
+#include "../util/hub75.h"
+#include "../util/ticker.h"
+
+static struct ticker tickers[TICKER_MAX];
+static struct ticker *drawing;		/* what ticker_pixel() draws in */
+static int drawn;					/* columns of it drawn so far */
+
+/*
+ * Set up a ticker over frame buffer rows 'y' to 'y + height - 1' of a
+ * frame buffer 'width' pixels wide, with 'size' pixels of 'buf' for its
+ * strip. Returns NULL if there isn't room for the strip to be at least
+ * twice the width, or no tickers are left. It shows nothing until its
+ * text has been drawn.
+ */
+struct ticker *
+ticker_add(int y, int height, int width, uint16_t *buf, int size)
+{
+	struct ticker	*t;
+	int				i;
+
+	if ((height < 1) || (size / height < 2 * width)) {
+		return NULL;
+	}
+	for (i = 0, t = tickers; i < TICKER_MAX; i++, t++) {
+		if (t->strip == NULL) {
+			break;
+		}
+	}
+	if (i == TICKER_MAX) {
+		return NULL;
+	}
+	t->active = 0;
+	t->y = y;
+	t->height = height;
+	t->width = width;
+	t->stride = size / height;
+	t->length = width;
+	t->speed = 0;
+	t->base = 0;
+	t->start = mtime();
+	t->offset = -1;
+	t->strip = buf;
+	return t;
+}
+
+/* Stop a ticker and give its rows back to the frame buffer */
+void
+ticker_remove(struct ticker *t)
+{
+	int	y;
+
+	t->active = 0;
+	for (y = 0; y < t->height; y++) {
+		hub75_row_source(t->y + y, NULL);
+	}
+	if (drawing == t) {
+		drawing = NULL;
+	}
+	t->strip = NULL;
+}
+
+/*
+ * Start drawing the text of a ticker, clearing the strip to 'bg'.
+ * Everything drawn with ticker_pixel() (give it to gfx_init() as the
+ * pixel function) until ticker_end() goes into the strip. It stops
+ * moving while it is drawn.
+ */
+void
+ticker_begin(struct ticker *t, uint16_t bg)
+{
+	int	i;
+
+	t->active = 0;
+	for (i = 0; i < t->height * t->stride; i++) {
+		t->strip[i] = bg;
+	}
+	drawing = t;
+	drawn = 0;
+}
+
+void
+ticker_pixel(int x, int y, uint16_t color)
+{
+	struct ticker	*t = drawing;
+
+	if ((t == NULL) || (x < 0) || (y < 0) || (y >= t->height) ||
+		(x >= t->stride - t->width)) {
+		return;
+	}
+	t->strip[y * t->stride + x] = color;
+	if (x >= drawn) {
+		drawn = x + 1;
+	}
+}
+
+/* Position along the strip, Q16 */
+static int32_t
+ticker_pos(const struct ticker *t, uint32_t now)
+{
+	int64_t	pos;
+	int32_t	len = t->length << 16;
+
+	pos = t->base + ((int64_t) t->speed * (int32_t) (now - t->start)) / 1000;
+	pos %= len;
+	return (int32_t) ((pos < 0) ? pos + len : pos);
+}
+
+/*
+ * The text is drawn. It repeats after what was drawn plus 'gap'
+ * pixels (at least the frame buffer width), and starts scrolling
+ * again from where it was. Returns that length, text that doesn't fit
+ * the strip is cut off.
+ */
+int
+ticker_end(struct ticker *t, int gap)
+{
+	uint16_t	*row;
+	int			x, y;
+
+	drawing = NULL;
+	t->length = drawn + gap;
+	if (t->length < t->width) {
+		t->length = t->width;
+	} else if (t->length > t->stride - t->width) {
+		t->length = t->stride - t->width;
+	}
+	for (y = 0, row = t->strip; y < t->height; y++, row += t->stride) {
+		for (x = t->length; x < t->length + t->width; x++) {
+			row[x] = row[x - t->length];
+		}
+	}
+	t->base = t->base % (t->length << 16);
+	t->offset = -1;
+	t->active = 1;
+	return t->length;
+}
+
+/*
+ * Scroll at 'speed' pixels a second (Q16), positive moves the text to
+ * the left, from wherever it is now.
+ */
+void
+ticker_speed(struct ticker *t, int32_t speed)
+{
+	uint32_t	now = mtime();
+	uint32_t	mask;
+
+	mask = cm_mask_interrupts(1);
+	t->base = ticker_pos(t, now);
+	t->start = now;
+	t->speed = speed;
+	cm_mask_interrupts(mask);
+}
+
+/*
+ * Point the rows of each ticker at where it should be at time 'now',
+ * called from the frame function so a whole frame shows one position.
+ */
+void
+ticker_update(uint32_t now)
+{
+	struct ticker	*t;
+	int				i, y, off;
+
+	for (i = 0, t = tickers; i < TICKER_MAX; i++, t++) {
+		if (! t->active) {
+			continue;
+		}
+		off = ticker_pos(t, now) >> 16;
+		if (off == t->offset) {
+			continue;
+		}
+		t->offset = off;
+		for (y = 0; y < t->height; y++) {
+			hub75_row_source(t->y + y, t->strip + y * t->stride + off);
+		}
+	}
+}
@@ -0,0 +1,36 @@
+/*
+ * ticker.h
+ *
+ * Scroll regions for the LED panel demos. A band of frame buffer rows
+ * shows a window onto a strip wider than the panel. The strip is drawn
+ * once (with the gfx library, through ticker_pixel()), and scrolling
+ * just moves the rows of the band along the strip, see
+ * hub75_row_source(). Nothing is redrawn while it scrolls.
+ */
+#ifndef __TICKER_H
+#define __TICKER_H
+
+#define TICKER_MAX		4
+
+struct ticker {
+	int			y, height;		/* frame buffer rows it covers */
+	int			width;			/* of the frame buffer */
+	uint16_t	*strip;			/* 'height' rows of 'stride' pixels */
+	int			stride;
+	int			length;			/* pixels before the strip repeats */
+	int32_t		speed;			/* pixels per second, Q16, + is to the left */
+	int32_t		base;			/* position (Q16) at 'start' */
+	uint32_t	start;			/* mtime() */
+	int			offset;			/* where the rows point now */
+	volatile int active;
+};
+
+struct ticker *ticker_add(int y, int height, int width, uint16_t *buf, int size);
+void ticker_remove(struct ticker *t);
+void ticker_begin(struct ticker *t, uint16_t bg);
+void ticker_pixel(int x, int y, uint16_t color);
+int ticker_end(struct ticker *t, int gap);
+void ticker_speed(struct ticker *t, int32_t speed);
+void ticker_update(uint32_t now);
+
+#endif /* generic header protector */
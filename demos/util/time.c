@@ -20,7 +20,7 @@
  */
 #include <stdio.h>
 #include <ctype.h>
-#include "time.h"
+#include "../util/time.h"
 #include "../util/util.h"
 
 static uint32_t	__epoch;
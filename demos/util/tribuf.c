@@ -0,0 +1,90 @@
+/*
+ * tribuf.c -- lock free triple buffering
+ *
+ * With only two buffers the renderer has to wait after each frame
+ * until the scanner has let go of the other one, which is up to a
+ * whole refresh. With three there is always one free: the renderer
+ * owns 'draw', the scanner owns 'display', and the third is 'ready',
+ * the newest complete frame. Both sides hand buffers over by swapping
+ * their index with 'ready' in one atomic exchange (LDREX/STREX), so
+ * neither masks interrupts or spins.
+ *
+ * Each published buffer is stamped with the cycle counter, so we can
+ * see how long frames wait between being finished and being shown.
+ */
+
+#include <stdint.h>
+#include <libopencm3/cm3/dwt.h>
+#include "../util/util.h"
+
+/*
+ * Start with 'a' to draw in and 'c' on display (so it should be
+ * cleared), 'b' is the spare.
+ */
+void
+tribuf_init(struct tribuf *tb, void *a, void *b, void *c)
+{
+	tb->buf[0] = a;
+	tb->buf[1] = b;
+	tb->buf[2] = c;
+	tb->draw = 0;
+	tb->ready = 1;
+	tb->display = 2;
+	tribuf_reset_stats(tb);
+}
+
+/*
+ * Renderer: the frame in the draw buffer is complete. Make it the
+ * ready one and return the buffer to draw the next frame in. If the
+ * previous ready frame was never shown it is dropped.
+ */
+void *
+tribuf_publish(struct tribuf *tb)
+{
+	uint32_t	old;
+
+	tb->stamp[tb->draw] = dwt_read_cycle_counter();
+	old = __atomic_exchange_n(&tb->ready, tb->draw | TRIBUF_FRESH,
+								__ATOMIC_SEQ_CST);
+	tb->published++;
+	if (old & TRIBUF_FRESH) {
+		tb->dropped++;
+	}
+	tb->draw = old & ~TRIBUF_FRESH;
+	return tb->buf[tb->draw];
+}
+
+/*
+ * Scanner: called at a frame boundary, returns the buffer to show,
+ * which is the newest complete frame or the current one again.
+ */
+void *
+tribuf_latest(struct tribuf *tb)
+{
+	uint32_t	old, lat;
+
+	if (tb->ready & TRIBUF_FRESH) {
+		/* only the renderer can change 'ready' under us, and it only
+		 * ever leaves a fresh frame there */
+		old = __atomic_exchange_n(&tb->ready, tb->display, __ATOMIC_SEQ_CST);
+		tb->display = old & ~TRIBUF_FRESH;
+		tb->shown++;
+		lat = dwt_read_cycle_counter() - tb->stamp[tb->display];
+		tb->lat_total += lat;
+		if (lat > tb->lat_max) {
+			tb->lat_max = lat;
+		}
+	} else {
+		tb->repeated++;
+	}
+	return tb->buf[tb->display];
+}
+
+void
+tribuf_reset_stats(struct tribuf *tb)
+{
+	tb->published = tb->dropped = 0;
+	tb->shown = tb->repeated = 0;
+	tb->lat_max = 0;
+	tb->lat_total = 0;
+}
@@ -16,6 +16,133 @@ uint32_t mtime(void);
 void clock_setup(void);
 void set_clock_hook(void (*hook_function)(void), int interval);
 
+/*
+ * Interrupt priorities, only the upper four bits are implemented
+ * on the STM32F4, and lower numbers preempt higher ones.
+ */
+#define IRQ_PRI_CONSOLE		(1 << 4)	/* never lose a received byte */
+#define IRQ_PRI_PANEL		(2 << 4)	/* LED panel timing */
+#define IRQ_PRI_SYSTICK		(4 << 4)
+#define IRQ_PRI_DEFER		(15 << 4)	/* PendSV, everything else first */
+
+/*
+ * The 64K of core coupled memory (see ../1bitsy.ld) is only on the
+ * CPU's data bus, DMA can't reach it, so it is for buffers that only
+ * the CPU touches. Nothing there is cleared at reset.
+ */
+#define CCM_DATA	__attribute__((section(".ccm_data")))
+
+/*
+ * Deferred work, run from PendSV after all other interrupts are
+ * serviced. Latencies are in CPU cycles.
+ */
+struct defer_stats {
+	uint32_t	posted;		/* items queued */
+	uint32_t	dropped;	/* items lost because the queue was full */
+	uint32_t	run;		/* items run */
+	uint32_t	depth_max;	/* most items waiting at once */
+	uint32_t	lat_min;	/* queue to run latency */
+	uint32_t	lat_max;
+	uint32_t	lat_avg;
+};
+
+void defer_setup(void);
+int defer_work(void (*func)(void));
+void defer_get_stats(struct defer_stats *s);
+void defer_reset_stats(void);
+
+/*
+ * Triple buffering (tribuf.c). The renderer draws into one buffer
+ * and publishes it, the scanner takes the newest published one at
+ * each frame boundary, and neither ever waits for the other.
+ */
+#define TRIBUF_FRESH	0x80		/* 'ready' hasn't been shown yet */
+
+struct tribuf {
+	void				*buf[3];
+	volatile uint32_t	ready;		/* newest complete frame (| TRIBUF_FRESH) */
+	int					draw;		/* owned by the renderer */
+	int					display;	/* owned by the scanner */
+	volatile uint32_t	published;	/* frames the renderer finished */
+	volatile uint32_t	dropped;	/* replaced before they were shown */
+	volatile uint32_t	shown;		/* new frames picked up by the scanner */
+	volatile uint32_t	repeated;	/* frame boundaries with nothing new */
+	uint32_t			stamp[3];	/* DWT when each buffer was published */
+	uint32_t			lat_max;	/* publish to pick up, in cycles */
+	uint64_t			lat_total;
+};
+
+void tribuf_init(struct tribuf *tb, void *a, void *b, void *c);
+void *tribuf_publish(struct tribuf *tb);
+void *tribuf_latest(struct tribuf *tb);
+void tribuf_reset_stats(struct tribuf *tb);
+
+/*
+ * Frame pacing (pacer.c). The demo loop asks pacer_due() if it is time
+ * for a frame, and if so pacer_changed() with a hash of what the frame
+ * would show. Only if that changed does it draw, then pacer_done().
+ */
+#define PACER_DEFAULT_FPS	60
+#define PACER_MAX_DIV		8		/* slowest is the target / 8 */
+
+struct pacer {
+	int			fps;			/* target rate */
+	int			div;			/* running at fps / div, 1 unless overrunning */
+	uint32_t	base;			/* mtime() of slot 0 */
+	int			slot;			/* next slot, 0 to fps - 1 */
+	uint32_t	hash;			/* of the last frame drawn */
+	int			fresh;			/* draw the next frame whatever its hash */
+	uint32_t	start;			/* DWT when the frame being drawn started */
+	int			over, under;	/* frames in a row over, and well under, a slot */
+	uint32_t	rendered;		/* frames drawn */
+	uint32_t	skipped;		/* slots where nothing had changed */
+	uint32_t	late;			/* frames still drawing at the next slot */
+	uint32_t	slowed;			/* times the rate was halved */
+	uint32_t	cycles;			/* drawing the rendered frames */
+	uint32_t	cycles_max;
+};
+
+void pacer_init(struct pacer *p, int fps);
+void pacer_force(struct pacer *p);
+int pacer_due(struct pacer *p, uint32_t now);
+int pacer_changed(struct pacer *p, uint32_t hash);
+void pacer_done(struct pacer *p, uint32_t now);
+void pacer_reset_stats(struct pacer *p);
+
+/*
+ * Arena allocator (arena.c). While an arena is in use malloc() and
+ * friends take memory from it, free() of its blocks does nothing and
+ * arena_reset() frees everything at once. The demo has to link with
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+ */
+struct arena {
+	uint8_t			*base;
+	uint32_t		size;
+	uint32_t		used;
+	uint32_t		last;		/* offset of the newest block */
+	uint32_t		peak;		/* most used since the stats were reset */
+	uint32_t		allocs;		/* blocks handed out */
+	uint32_t		overflows;	/* requests that went to the heap instead */
+	struct arena	*next;
+};
+
+struct heap_stats {
+	uint32_t	live;			/* bytes malloc()'d and not yet freed */
+	uint32_t	peak;			/* the most live at once */
+	uint32_t	blocks;			/* how many blocks that is */
+	uint32_t	heap;			/* size of the heap so far */
+	uint32_t	free;			/* bytes free inside it */
+	uint32_t	free_blocks;	/* in this many pieces */
+};
+
+void arena_init(struct arena *a, void *buf, uint32_t size);
+void arena_reset(struct arena *a);
+void arena_reset_stats(struct arena *a);
+struct arena *arena_use(struct arena *a);
+void *arena_alloc(struct arena *a, uint32_t size);
+void heap_get_stats(struct heap_stats *s);
+void heap_reset_peak(void);
+
 /*
  * Our simple console definitions
  */
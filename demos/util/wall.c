@@ -0,0 +1,437 @@
+/*
+ * wall.c -- several boards showing one frame on a wall of panels
+ *
+ * The master (board 0) draws a frame a slice at a time. Each of the
+ * other boards' slices is sent over USART2 as soon as it is drawn
+ * (wall_send()), its own goes into its frame buffer, and when they are
+ * all out wall_sync() pulses the sync line. Every board, the master
+ * included, publishes its slice on that edge, so each one's scanner
+ * picks the frame up at its next frame boundary. A board never shows a
+ * slice that isn't all there, and they all change within a refresh of
+ * each other.
+ *
+ * The other boards receive with DMA (USART2 RX is DMA1 stream 5 channel
+ * 4, TX is stream 6) the same way stream.c does on the console: the
+ * header, then the slice straight into the end of the frame buffer
+ * being drawn, where wall_poll() checks and unpacks it. The sync edge
+ * is EXTI0, at the console's priority so nothing but a masked section
+ * holds it up. Slices for other boards are received into the sink.
+ *
+ * The time from the sync edge to the new frame being lit is measured
+ * with the frame hook (see hub75_frame_hook()), on every board.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/gpio.h>
+#include <libopencm3/stm32/usart.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/exti.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/dwt.h>
+#include "../util/util.h"
+#include "../util/hub75.h"
+#include "../util/stream.h"
+#include "../util/wall.h"
+
+#define WALL_USART			USART2
+#define WALL_DMA			DMA1
+#define WALL_DMA_RX			DMA_STREAM5
+#define WALL_DMA_TX			DMA_STREAM6
+#define WALL_DMA_CHANNEL	DMA_SxCR_CHSEL_4
+#define WALL_DMA_FLAGS		(DMA_TCIF | DMA_HTIF | DMA_TEIF | DMA_DMEIF | DMA_FEIF)
+
+#define RX_HDR		0		/* waiting for (the rest of) a header */
+#define RX_DATA		1		/* waiting for the slice */
+#define RX_DONE		2		/* a whole slice of ours, for wall_poll() */
+#define RX_SKIP		3		/* someone else's, into the sink */
+
+static const struct stream_panel *panel;
+static struct wall_stats *stats;
+static int wall_board;
+static int wall_pixels;				/* in a slice */
+
+static struct stream_hdr rx_hdr;
+static volatile int rx_state;
+static uint8_t rx_sink;
+static uint16_t rx_was;				/* for the timeout */
+static uint32_t rx_last;
+
+static volatile int ready;			/* a whole slice is in *panel->draw */
+static volatile uint32_t rx_slices;	/* of ours started, see wall_poll() */
+static volatile uint32_t sync_at;	/* DWT at the last sync edge */
+static const uint16_t *volatile sync_fb;	/* published then, until it is lit */
+static uint32_t sent_at;			/* DWT when the last slice went out */
+
+/* Start receiving 'len' bytes into 'buf', or into the sink if it's NULL */
+static void
+rx_start(void *buf, int len)
+{
+	dma_disable_stream(WALL_DMA, WALL_DMA_RX);
+	while (DMA_SCR(WALL_DMA, WALL_DMA_RX) & DMA_SxCR_EN) ;
+	dma_clear_interrupt_flags(WALL_DMA, WALL_DMA_RX, WALL_DMA_FLAGS);
+	if (buf != NULL) {
+		dma_enable_memory_increment_mode(WALL_DMA, WALL_DMA_RX);
+	} else {
+		dma_disable_memory_increment_mode(WALL_DMA, WALL_DMA_RX);
+		buf = &rx_sink;
+	}
+	dma_set_memory_address(WALL_DMA, WALL_DMA_RX, (uint32_t) buf);
+	dma_set_number_of_data(WALL_DMA, WALL_DMA_RX, len);
+	dma_enable_stream(WALL_DMA, WALL_DMA_RX);
+}
+
+static void
+rx_header(void)
+{
+	rx_state = RX_HDR;
+	rx_was = sizeof(rx_hdr);
+	rx_last = mtime();
+	rx_start(&rx_hdr, sizeof(rx_hdr));
+}
+
+/* Send 'len' bytes and wait until they have gone */
+static void
+tx_send(const void *buf, int len)
+{
+	dma_disable_stream(WALL_DMA, WALL_DMA_TX);
+	while (DMA_SCR(WALL_DMA, WALL_DMA_TX) & DMA_SxCR_EN) ;
+	dma_clear_interrupt_flags(WALL_DMA, WALL_DMA_TX, WALL_DMA_FLAGS);
+	dma_set_memory_address(WALL_DMA, WALL_DMA_TX, (uint32_t) buf);
+	dma_set_number_of_data(WALL_DMA, WALL_DMA_TX, len);
+	dma_enable_stream(WALL_DMA, WALL_DMA_TX);
+	while (! dma_get_interrupt_flag(WALL_DMA, WALL_DMA_TX, DMA_TCIF)) ;
+	while ((USART_SR(WALL_USART) & USART_SR_TC) == 0) ;
+}
+
+/*
+ * A header or a slice came in. A good header for this board starts its
+ * slice on the end of the frame buffer being drawn, any other message
+ * goes into the sink so the next header is found where it should be.
+ */
+void
+dma1_stream5_isr(void)
+{
+	uint8_t	*b = (uint8_t *) &rx_hdr;
+	int		i, n;
+
+	if (! dma_get_interrupt_flag(WALL_DMA, WALL_DMA_RX, DMA_TCIF)) {
+		dma_clear_interrupt_flags(WALL_DMA, WALL_DMA_RX, WALL_DMA_FLAGS);
+		return;
+	}
+	dma_clear_interrupt_flags(WALL_DMA, WALL_DMA_RX, DMA_TCIF);
+	if (rx_state == RX_DATA) {
+		rx_state = RX_DONE;
+		return;
+	}
+	if (rx_state == RX_SKIP) {
+		rx_header();
+		return;
+	}
+
+	if ((b[0] == STREAM_MAGIC0) && (b[1] == STREAM_MAGIC1) &&
+		(stream_fletcher(b, offsetof(struct stream_hdr, check)) == rx_hdr.check)) {
+		n = stream_frame_bytes(wall_pixels, WALL_PIXELS(rx_hdr.format));
+		if ((rx_hdr.type != STREAM_SLICE) ||
+			(WALL_BOARD(rx_hdr.format) != wall_board) ||
+			(n == 0) || (rx_hdr.len != n)) {
+			if (WALL_BOARD(rx_hdr.format) == wall_board) {
+				stats->errors++;
+			}
+			if (rx_hdr.len == 0) {
+				rx_header();
+			} else {
+				rx_state = RX_SKIP;
+				rx_start(NULL, rx_hdr.len);
+			}
+			return;
+		}
+		if (ready) {
+			/* the one waiting for a sync is too old now */
+			ready = 0;
+			stats->overruns++;
+		}
+		rx_slices++;
+		rx_state = RX_DATA;
+		rx_start((uint8_t *) *panel->draw +
+					stream_frame_bytes(wall_pixels, STREAM_RGB565) - n, n);
+		return;
+	}
+
+	/* keep anything from the next magic number on and read the rest */
+	stats->resyncs++;
+	for (i = 1; i < (int) sizeof(rx_hdr); i++) {
+		if ((b[i] == STREAM_MAGIC0) &&
+			((i == sizeof(rx_hdr) - 1) || (b[i + 1] == STREAM_MAGIC1))) {
+			break;
+		}
+	}
+	memmove(b, b + i, sizeof(rx_hdr) - i);
+	rx_start(b + sizeof(rx_hdr) - i, i);
+}
+
+/* Show the slice that is ready, at the sync edge */
+static void
+wall_show(void)
+{
+	sync_at = dwt_read_cycle_counter();
+	if (! ready) {
+		stats->missed++;
+		return;
+	}
+	ready = 0;
+	sync_fb = *panel->draw;
+	panel->done();
+	stats->frames++;
+}
+
+void
+exti0_isr(void)
+{
+	exti_reset_request(EXTI0);
+	wall_show();
+}
+
+/* Frame hook, the first frame boundary showing what the sync published */
+static void
+wall_lit(const uint16_t *fb, int new_frame)
+{
+	uint32_t	lag;
+
+	if (! new_frame || (fb != sync_fb)) {
+		return;
+	}
+	sync_fb = NULL;
+	lag = dwt_read_cycle_counter() - sync_at;
+	stats->lit++;
+	stats->lag_total += lag;
+	if (lag < stats->lag_min) {
+		stats->lag_min = lag;
+	}
+	if (lag > stats->lag_max) {
+		stats->lag_max = lag;
+	}
+}
+
+/*
+ * Join the wall as 'board' (0 is the master) with the frame buffers of
+ * 'p', which is its slice of the wall. Returns -1 for a board number
+ * that's out of range. The console is left alone.
+ */
+int
+wall_begin(const struct stream_panel *p, int board, struct wall_stats *st)
+{
+	uint32_t	dma_stream = (board) ? WALL_DMA_RX : WALL_DMA_TX;
+
+	if ((board < 0) || (board >= WALL_MAX_BOARDS)) {
+		return -1;
+	}
+	panel = p;
+	stats = st;
+	memset(st, 0, sizeof(*st));
+	st->lag_min = 0xffffffff;
+	wall_board = board;
+	wall_pixels = p->width * p->height;
+	ready = 0;
+	sync_fb = NULL;
+
+	rcc_periph_clock_enable(RCC_GPIOA);
+	rcc_periph_clock_enable(RCC_GPIOC);
+	rcc_periph_clock_enable(RCC_USART2);
+	rcc_periph_clock_enable(RCC_DMA1);
+	gpio_mode_setup(GPIOA, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO2 | GPIO3);
+	gpio_set_af(GPIOA, GPIO_AF7, GPIO2 | GPIO3);
+	usart_set_baudrate(WALL_USART, WALL_BAUD);
+	usart_set_databits(WALL_USART, 8);
+	usart_set_stopbits(WALL_USART, USART_STOPBITS_1);
+	usart_set_parity(WALL_USART, USART_PARITY_NONE);
+	usart_set_flow_control(WALL_USART, USART_FLOWCONTROL_NONE);
+	usart_set_mode(WALL_USART, (board) ? USART_MODE_RX : USART_MODE_TX);
+
+	dma_stream_reset(WALL_DMA, dma_stream);
+	dma_channel_select(WALL_DMA, dma_stream, WALL_DMA_CHANNEL);
+	dma_set_priority(WALL_DMA, dma_stream, DMA_SxCR_PL_HIGH);
+	dma_set_memory_size(WALL_DMA, dma_stream, DMA_SxCR_MSIZE_8BIT);
+	dma_set_peripheral_size(WALL_DMA, dma_stream, DMA_SxCR_PSIZE_8BIT);
+	dma_set_peripheral_address(WALL_DMA, dma_stream,
+								(uint32_t) &USART_DR(WALL_USART));
+	if (board) {
+		dma_set_transfer_mode(WALL_DMA, dma_stream, DMA_SxCR_DIR_PERIPHERAL_TO_MEM);
+		dma_enable_transfer_complete_interrupt(WALL_DMA, dma_stream);
+		nvic_set_priority(NVIC_DMA1_STREAM5_IRQ, IRQ_PRI_CONSOLE);
+		nvic_enable_irq(NVIC_DMA1_STREAM5_IRQ);
+		usart_enable_rx_dma(WALL_USART);
+	} else {
+		dma_enable_memory_increment_mode(WALL_DMA, dma_stream);
+		dma_set_transfer_mode(WALL_DMA, dma_stream, DMA_SxCR_DIR_MEM_TO_PERIPHERAL);
+		usart_enable_tx_dma(WALL_USART);
+	}
+	usart_enable(WALL_USART);
+	(void) USART_SR(WALL_USART);
+	(void) USART_DR(WALL_USART);
+
+	hub75_frame_hook(wall_lit);
+	if (board) {
+		/* the sync line is an input with an interrupt on its rising edge */
+		rcc_periph_clock_enable(RCC_SYSCFG);
+		gpio_mode_setup(GPIOC, GPIO_MODE_INPUT, GPIO_PUPD_PULLDOWN, WALL_SYNC);
+		exti_select_source(EXTI0, GPIOC);
+		exti_set_trigger(EXTI0, EXTI_TRIGGER_RISING);
+		exti_enable_request(EXTI0);
+		nvic_set_priority(NVIC_EXTI0_IRQ, IRQ_PRI_CONSOLE);
+		nvic_enable_irq(NVIC_EXTI0_IRQ);
+		rx_header();
+	} else {
+		gpio_clear(GPIOC, WALL_SYNC);
+		gpio_mode_setup(GPIOC, GPIO_MODE_OUTPUT, GPIO_PUPD_NONE, WALL_SYNC);
+		sent_at = dwt_read_cycle_counter();
+	}
+	return 0;
+}
+
+/* Leave the wall, USART2 and the sync line are let go */
+void
+wall_end(void)
+{
+	hub75_frame_hook(NULL);
+	if (wall_board) {
+		nvic_disable_irq(NVIC_EXTI0_IRQ);
+		exti_disable_request(EXTI0);
+		nvic_disable_irq(NVIC_DMA1_STREAM5_IRQ);
+		dma_disable_stream(WALL_DMA, WALL_DMA_RX);
+		usart_disable_rx_dma(WALL_USART);
+	} else {
+		dma_disable_stream(WALL_DMA, WALL_DMA_TX);
+		usart_disable_tx_dma(WALL_USART);
+		gpio_mode_setup(GPIOC, GPIO_MODE_INPUT, GPIO_PUPD_PULLDOWN, WALL_SYNC);
+	}
+	usart_disable(WALL_USART);
+}
+
+/*
+ * Master: send 'board' its slice of frame 'seq'. The slice is RGB565
+ * and is packed to 'format' where it is (so it is lost), RGB444 isn't
+ * done. Returns -1 if the board or format won't do.
+ */
+int
+wall_send(int board, uint16_t *slice, int format, uint16_t seq)
+{
+	struct stream_hdr	hdr;
+	uint8_t				*out = (uint8_t *) slice;
+	uint32_t			pix;
+	int					i, len;
+
+	if ((board < 1) || (board >= WALL_MAX_BOARDS) || (wall_board != 0)) {
+		return -1;
+	}
+	len = stream_frame_bytes(wall_pixels, format);
+	switch (format) {
+	case STREAM_RGB111 :
+		/* each byte is written after the pixels it holds were read */
+		for (i = 0; i < wall_pixels; i += 2) {
+			out[i / 2] = RGB565_TO_3BIT(slice[i]) |
+							(RGB565_TO_3BIT(slice[i + 1]) << 4);
+		}
+		break;
+	case STREAM_RGB332 :
+		for (i = 0; i < wall_pixels; i++) {
+			pix = slice[i];
+			out[i] = ((pix >> 8) & 0xe0) | ((pix >> 6) & 0x1c) | ((pix >> 3) & 3);
+		}
+		break;
+	case STREAM_RGB565 :
+		break;
+	default :
+		return -1;
+	}
+
+	hdr.magic[0] = STREAM_MAGIC0;
+	hdr.magic[1] = STREAM_MAGIC1;
+	hdr.type = STREAM_SLICE;
+	hdr.format = WALL_FORMAT(board, format);
+	hdr.seq = seq;
+	hdr.len = len;
+	hdr.sum = stream_fletcher(out, len);
+	hdr.check = stream_fletcher((uint8_t *) &hdr, offsetof(struct stream_hdr, check));
+	tx_send(&hdr, sizeof(hdr));
+	tx_send(out, len);
+	sent_at = dwt_read_cycle_counter();
+	stats->slices++;
+	return 0;
+}
+
+/*
+ * Master: the frame is all drawn (the master's own slice in
+ * *panel->draw) and sent. Once the last board to get its slice has had
+ * time to unpack it, pulse the sync line and show it here too.
+ */
+void
+wall_sync(void)
+{
+	uint32_t	start;
+
+	while (dwt_read_cycle_counter() - sent_at < WALL_SETTLE) ;
+	ready = 1;
+	gpio_set(GPIOC, WALL_SYNC);
+	wall_show();
+	start = dwt_read_cycle_counter();
+	while (dwt_read_cycle_counter() - start < WALL_SYNC_PULSE) ;
+	gpio_clear(GPIOC, WALL_SYNC);
+}
+
+/*
+ * The other boards: check and unpack a slice that has come in, it is
+ * shown at the next sync. A message that stops part way is dropped
+ * after STREAM_TIMEOUT mS.
+ */
+void
+wall_poll(void)
+{
+	struct stream_hdr	hdr;
+	uint32_t	mask, n;
+	uint16_t	left;
+	uint16_t	*fb = *panel->draw;
+	int			y;
+
+	if (rx_state != RX_DONE) {
+		left = dma_get_number_of_data(WALL_DMA, WALL_DMA_RX);
+		if ((left != rx_was) || ((rx_state == RX_HDR) && (left == sizeof(rx_hdr)))) {
+			rx_was = left;
+			rx_last = mtime();
+		} else if (mtime() - rx_last > STREAM_TIMEOUT) {
+			mask = cm_mask_interrupts(1);
+			if (rx_state != RX_DONE) {
+				rx_header();
+				stats->timeouts++;
+			}
+			cm_mask_interrupts(mask);
+		}
+		return;
+	}
+
+	/* the master goes straight on to the next board's slice */
+	hdr = rx_hdr;
+	n = rx_slices;
+	rx_header();
+	if (stream_fletcher((uint8_t *) fb + stream_frame_bytes(wall_pixels,
+							STREAM_RGB565) - hdr.len, hdr.len) != hdr.sum) {
+		stats->errors++;
+		return;
+	}
+	stream_unpack(fb, wall_pixels, WALL_PIXELS(hdr.format));
+	for (y = 0; y < panel->height; y++) {
+		hub75_dirty(y);
+	}
+	stats->slices++;
+	/* unless the next one has started coming in on top of it */
+	mask = cm_mask_interrupts(1);
+	if (rx_slices == n) {
+		ready = 1;
+	} else {
+		stats->overruns++;
+	}
+	cm_mask_interrupts(mask);
+}
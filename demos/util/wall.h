@@ -0,0 +1,60 @@
+/*
+ * wall.h
+ *
+ * A wall of panels driven by several boards, each with its own chain,
+ * see wall.c. Board 0 (the master) draws the whole wall, sends each of
+ * the others its slice over USART2, and then raises the sync line so
+ * that every board shows the new frame at once.
+ *
+ *	PA2 - USART2 TX, from the master to every other board's PA3
+ *	PA3 - USART2 RX
+ *	PC0 - sync, driven by the master, EXTI0 on the others
+ *
+ * and a common ground. A slice is a stream message (see stream.h) of
+ * type STREAM_SLICE, the pixel format in the low nibble of 'format'
+ * and the board it is for in the high one, the frame number in 'seq'.
+ * Nothing is sent back.
+ */
+#ifndef __WALL_H
+#define __WALL_H
+
+#define WALL_MAX_BOARDS		4
+#define WALL_BAUD			STREAM_MAX_BAUD
+#define WALL_SYNC			GPIO0		/* on GPIOC */
+#define WALL_SYNC_PULSE		168			/* cycles the sync line is high, 1uS */
+#define WALL_SETTLE			(168 * 500)	/* cycles for the others to unpack */
+
+#define WALL_FORMAT(b, fmt)	(((b) << 4) | (fmt))
+#define WALL_BOARD(format)	((format) >> 4)
+#define WALL_PIXELS(format)	((format) & 0xf)
+
+/*
+ * 'lag' is from the sync edge to the new frame being lit, it depends
+ * on where each board's refresh is, so boards can differ by up to
+ * lag_max - lag_min.
+ */
+struct wall_stats {
+	uint32_t	frames;			/* shown at a sync */
+	uint32_t	slices;			/* received (sent, on the master) */
+	uint32_t	errors;			/* bad checksums and sizes */
+	uint32_t	missed;			/* syncs with no whole slice to show */
+	uint32_t	overruns;		/* slices replaced before they were shown */
+	uint32_t	resyncs;		/* headers that had to be hunted for */
+	uint32_t	timeouts;		/* slices that stopped part way */
+	uint32_t	lit;			/* frames seen lit, for the lag */
+	uint64_t	lag_total;		/* cycles */
+	uint32_t	lag_min;
+	uint32_t	lag_max;
+};
+
+int wall_begin(const struct stream_panel *p, int board, struct wall_stats *st);
+void wall_end(void);
+
+/* master */
+int wall_send(int board, uint16_t *slice, int format, uint16_t seq);
+void wall_sync(void);
+
+/* the others */
+void wall_poll(void);
+
+#endif /* generic header protector */
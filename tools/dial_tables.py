@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# dial_tables.py -- write demos/util/dial.c, the clock face geometry
+#
+# The clock demos used to work out every hand with sin() and cos() in
+# double precision (soft float on the Cortex-M4) each frame, for hands
+# that only ever point one of a few thousand ways. This works them all
+# out once, as whole pixels; see demos/util/dial.h for the layout. Run
+# it again if a hand's length or the number of steps changes.
+#
+# The face comes out just as it did. Each hand's end is truncated the
+# way the C code did it too, except that the angles are exact multiples
+# of the step rather than sums of doubles, so an end that sits right on
+# a pixel boundary doesn't drop a pixel for being 1e-15 short of it.
+#
+# --check prints how many entries differ from what the old expressions
+# give, with the same libm, and which.
+#
+
+import argparse
+import math
+import os
+import sys
+
+CX, CY = 32, 32
+EPSILON = 1e-9
+
+# name, length, steps a turn, as in dial.h
+HANDS = [
+    ('dial_ms', 10, 1000),
+    ('dial_sec', 25, 3600),
+    ('dial_min', 20, 3600),
+    ('dial_hour', 15, 1440),
+]
+TICK_OUT, TICK_IN = 30, 25
+RIM, RIM_INC = 31, 5
+
+
+def hand(length, steps, i):
+    a = 2 * math.pi * i / steps
+    return (math.floor(CX + length * math.sin(a) + EPSILON),
+            math.floor(CY - length * math.cos(a) + EPSILON))
+
+
+def face(radius, a):
+    # just as draw_face() had it, so the face looks the same
+    return (int(32.5 + radius * math.sin(a)), int(32.5 + radius * math.cos(a)))
+
+
+def old_hand(length, steps, i):
+    # what draw_clock() worked out for the same step
+    if steps == 1000:
+        a = float(i) / 500.0 * math.pi
+    elif steps == 3600:
+        a = (i // 60 + (i % 60) / 60.0) / 30.0 * math.pi
+    else:
+        a = (float(i // 60) + float(i % 60) / 60.0) / 12.0 * math.pi
+    return (int(CX + length * math.sin(a)), int(CY - length * math.cos(a)))
+
+
+def points(name, pts, per_line=6):
+    out = []
+    for i in range(0, len(pts), per_line):
+        out.append('\t' + ' '.join('{ %2d, %2d },' % p
+                                   for p in pts[i:i + per_line]))
+    return out
+
+
+def tables():
+    t = []
+    for name, length, steps in HANDS:
+        t.append((name, '%d long, %d steps a turn' % (length, steps),
+                  '[%d]' % steps, [hand(length, steps, i) for i in range(steps)]))
+    ticks = []
+    for i in range(60):
+        a = i / 30.0 * math.pi
+        ticks.append([face(TICK_OUT, a), face(TICK_IN, a)])
+    rim = [face(RIM, float(i) / 180.0 * math.pi) for i in range(0, 361, RIM_INC)]
+    return t, ticks, rim
+
+
+def write(path, t, ticks, rim):
+    lines = [
+        '/*',
+        ' * dial.c -- clock face geometry, written by tools/dial_tables.py',
+        ' *',
+        ' * Do not edit, change the script and run it again. See dial.h.',
+        ' */',
+        '',
+        '#include <stdint.h>',
+        '#include "../util/dial.h"',
+    ]
+    for name, what, size, pts in t:
+        lines += ['', '/* %s */' % what,
+                  'const struct dial_point %s%s = {' % (name, size)]
+        lines += points(name, pts)
+        lines.append('};')
+    lines += ['', '/* tick marks, out at %d and in at %d */' % (TICK_OUT, TICK_IN),
+              'const struct dial_point dial_tick[DIAL_TICKS][2] = {']
+    for i in range(0, len(ticks), 3):
+        lines.append('\t' + ' '.join('{ { %2d, %2d }, { %2d, %2d } },' %
+                                     (o[0], o[1], n[0], n[1])
+                                     for o, n in ticks[i:i + 3]))
+    lines.append('};')
+    lines += ['', '/* the rim, %d out every %d degrees */' % (RIM, RIM_INC),
+              'const struct dial_point dial_rim[DIAL_RIM + 1] = {']
+    lines += points('dial_rim', rim)
+    lines.append('};')
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def check(t, ticks, rim):
+    bad = 0
+    for (name, what, size, pts), (_, length, steps) in zip(t, HANDS):
+        diff = [i for i in range(steps) if pts[i] != old_hand(length, steps, i)]
+        bad += len(diff)
+        print('%-10s %4d of %4d differ%s' % (name, len(diff), steps,
+              (' (' + ', '.join(str(i) for i in diff[:8]) +
+               (' ...' if len(diff) > 8 else '') + ')') if diff else ''))
+    old = [[(int(32.5 + r * math.sin(i / 30.0 * math.pi)),
+             int(32.5 + r * math.cos(i / 30.0 * math.pi)))
+            for r in (TICK_OUT, TICK_IN)] for i in range(60)]
+    diff = [i for i in range(60) if ticks[i] != old[i]]
+    print('%-10s %4d of %4d differ' % ('dial_tick', len(diff), 60))
+    old = [(int(32.5 + RIM * math.sin(float(i) / 180.0 * math.pi)),
+            int(32.5 + RIM * math.cos(float(i) / 180.0 * math.pi)))
+           for i in range(0, 361, RIM_INC)]
+    diff = [i for i in range(len(rim)) if rim[i] != old[i]]
+    print('%-10s %4d of %4d differ' % ('dial_rim', len(diff), len(rim)))
+    return bad + len(diff)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description='Write the clock face tables')
+    ap.add_argument('-o', '--output',
+                    default=os.path.join(here, '..', 'demos', 'util', 'dial.c'))
+    ap.add_argument('--check', action='store_true',
+                    help='compare with the old sin()/cos() expressions')
+    args = ap.parse_args()
+    t, ticks, rim = tables()
+    if args.check:
+        check(t, ticks, rim)
+        return 0
+    write(args.output, t, ticks, rim)
+    print('wrote %s' % os.path.normpath(args.output))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# fmath_check.py -- check demos/util/fmath.c against libm on the host
+#
+# Builds fmath.c for the host with a small driver that runs each
+# function over a sweep of arguments (and every binary angle for the
+# Q15 sine) and finds its largest error against the double precision
+# libm result, then checks those against the bounds in fmath.h. The
+# host has no vsqrt so fm_sqrtf() is its Newton version here, which is
+# the one that needs checking.
+#
+# Exits 1 if any function is outside its bound.
+#
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+DRIVER = r'''
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fmath.h"
+
+#define STEPS		2000000
+#define TURN_RAD	(2 * M_PI / FM_TURN)
+
+static double
+turn_diff(double a, double b)
+{
+	double	d = fmod(a - b, FM_TURN);
+
+	if (d > FM_TURN / 2) {
+		d -= FM_TURN;
+	} else if (d < -FM_TURN / 2) {
+		d += FM_TURN;
+	}
+	return fabs(d);
+}
+
+int
+main(int argc, char **argv)
+{
+	double	e, sin_err = 0, atan_err = 0, sqrt_err = 0, q15_err = 0, qa_err = 0;
+	double	range = atof(argv[1]);
+	uint32_t	q16_bad = 0, x;
+	int		i;
+
+	srand(1);
+	for (i = 0; i <= STEPS; i++) {
+		float	f = (float) (range * (2.0 * i / STEPS - 1));
+
+		e = fabs(fm_sinf(f) - sin((double) f));
+		sin_err = (e > sin_err) ? e : sin_err;
+		e = fabs(fm_cosf(f) - cos((double) f));
+		sin_err = (e > sin_err) ? e : sin_err;
+	}
+	for (i = 0; i < STEPS; i++) {
+		float	a = (float) (2 * M_PI * i / STEPS);
+		float	r = (float) pow(10, 6.0 * rand() / RAND_MAX - 3);
+		float	y = r * sinf(a), x = r * cosf(a);
+
+		if (i % 4 == 0) {
+			y = (float) (rand() - RAND_MAX / 2);
+			x = (float) (rand() - RAND_MAX / 2);
+		}
+		e = fabs(fm_atan2f(y, x) - atan2((double) y, (double) x));
+		if (e > M_PI) {
+			e = fabs(e - 2 * M_PI);
+		}
+		atan_err = (e > atan_err) ? e : atan_err;
+
+		x = (float) pow(10, 12.0 * rand() / RAND_MAX - 6);
+		e = fabs(fm_sqrtf(x) - sqrt((double) x)) / sqrt((double) x);
+		sqrt_err = (e > sqrt_err) ? e : sqrt_err;
+	}
+	for (i = 0; i < FM_TURN; i++) {
+		e = fabs(fm_sin_q15(i) - sin(i * TURN_RAD) * FM_Q15_ONE);
+		q15_err = (e > q15_err) ? e : q15_err;
+		e = fabs(fm_cos_q15(i) - cos(i * TURN_RAD) * FM_Q15_ONE);
+		q15_err = (e > q15_err) ? e : q15_err;
+	}
+	for (i = 0; i < STEPS; i++) {
+		int32_t	r = (i & 1) ? 1 + rand() % 2000 : 1 + rand() % 1000000;
+		double	a = 2 * M_PI * rand() / RAND_MAX;
+		int32_t	y = (int32_t) lround(r * sin(a)), x = (int32_t) lround(r * cos(a));
+
+		if ((x | y) == 0) {
+			continue;
+		}
+		e = turn_diff(fm_atan2_q15(y, x), atan2(y, x) / TURN_RAD);
+		qa_err = (e > qa_err) ? e : qa_err;
+	}
+	for (i = 0; i < STEPS; i++) {
+		uint64_t	v, r;
+
+		/* every size of argument, and the first and last few */
+		x = (i < 1000) ? i : (i < 2000) ? 0xffffffffU - (i - 1000) :
+			((uint32_t) rand() << 1 ^ rand()) >> (rand() % 32);
+		v = (uint64_t) x << 16;
+		r = (uint64_t) sqrtl((long double) v);
+		while (r * r > v) {
+			r--;
+		}
+		while ((r + 1) * (r + 1) <= v) {
+			r++;
+		}
+		q16_bad += fm_sqrt_q16(x) != r;
+	}
+	printf("%.3g %.3g %.3g %.3g %.3g %u\n", sin_err, atan_err, sqrt_err,
+			q15_err, qa_err, q16_bad);
+	return 0;
+}
+'''
+
+# function, bound and unit, as fmath.h gives them
+BOUNDS = [
+    ('fm_sinf, fm_cosf', 1e-7, ''),
+    ('fm_atan2f', 3.4e-7, ' radians'),
+    ('fm_sqrtf (no FPU)', 1e-7, ' of the root'),
+    ('fm_sin_q15, fm_cos_q15', 3, ' LSB'),
+    ('fm_atan2_q15', 2, ' of FM_TURN'),
+    ('fm_sqrt_q16', 0, ' results not exact'),
+]
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description='Check fmath.c against libm')
+    ap.add_argument('--range', type=float, default=1000,
+                    help='sin and cos of -range to range (%(default)s)')
+    args = ap.parse_args()
+
+    util = os.path.join(here, '..', 'demos', 'util')
+    tmp = tempfile.mkdtemp()
+    try:
+        src = os.path.join(tmp, 'drv.c')
+        with open(src, 'w') as f:
+            f.write(DRIVER)
+        drv = os.path.join(tmp, 'drv')
+        r = subprocess.run(['cc', '-O2', '-I', util, '-o', drv, src,
+                            os.path.join(util, 'fmath.c'), '-lm'],
+                           capture_output=True, text=True)
+        if r.returncode:
+            print('fmath.c didn\'t build:\n' + r.stderr, file=sys.stderr)
+            return 1
+        out = subprocess.run([drv, str(args.range)], capture_output=True,
+                             text=True, check=True).stdout.split()
+    finally:
+        shutil.rmtree(tmp)
+
+    failed = 0
+    for (name, bound, unit), got in zip(BOUNDS, out):
+        ok = float(got) <= bound
+        failed |= not ok
+        print('%-24s %-10s%s, bound %g  %s' % (name, got, unit, bound,
+                                               'ok' if ok else 'FAILED'))
+    return failed
+
+
+if __name__ == '__main__':
+    sys.exit(main())
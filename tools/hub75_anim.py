@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+#
+# hub75_anim.py -- bake an animation for the BCM engine to play
+#
+# Turns a GIF, a list of PNG (or PPM) files, or one of the built in
+# patterns into a C file with a struct hub75_anim (see demos/util/hub75.h)
+# for hub75_bcm_play(). The frames are encoded here by the engine's own
+# bcm_encode() (hub75.c built for the host by hub75_host.py): RGB565,
+# gamma, levels, bit-planes and the order the panels are clocked in, so
+# the board only has to shift them out. That means an animation is made
+# for one geometry and depth (and gamma): --demo picks those of one of
+# the demos, or give them.
+#
+# By default each frame is stored as its changes to the one before,
+# which the engine applies to its planes at the frame boundary; --raw
+# stores every frame whole, for the engine to shift straight from
+# flash. The changes are checked by applying them again with the
+# engine's anim_apply().
+#
+# Needs PIL for anything other than binary PPM files and the patterns.
+#
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+from hub75_host import Host
+
+FLIP_X, FLIP_Y, SWAP_XY = 1, 2, 4
+RUN_GAP = 4                     # unchanged bytes cheaper to copy than skip
+
+# width, height, panel width, height, scan, chain, chains, panels (x, y, flags)
+DEMOS = {
+    'leds': (64, 64, 64, 32, 16, 2, 1, [(0, 32, 0), (0, 0, FLIP_X | FLIP_Y)]),
+    'led2': (64, 64, 64, 64, 32, 1, 1, [(0, 0, FLIP_Y)]),
+}
+
+
+class Geometry:
+    def __init__(self, w, h, pw, ph, scan, chain, chains, panels):
+        self.width, self.height = w, h
+        self.panel_width, self.panel_height = pw, ph
+        self.scan, self.chain, self.chains = scan, chain, chains
+        if not panels:
+            # a band of the frame buffer per chain, as hub75.c does
+            panels = [(j * pw, k * ph, 0) for k in range(chains)
+                      for j in range(chain)]
+        self.panels = panels
+        self.plane_len = pw * chain * chains
+
+    def offset(self, pn, x, y):
+        px, py, flags = pn
+        if flags & FLIP_X:
+            x = self.panel_width - 1 - x
+        if flags & FLIP_Y:
+            y = self.panel_height - 1 - y
+        if flags & SWAP_XY:
+            x, y = y, x
+        return (py + y) * self.width + px + x
+
+
+def delta(prev, cur):
+    """The records that turn planes prev into cur, see hub75.h."""
+    runs = []
+    i, n = 0, len(cur)
+    while i < n:
+        if prev[i] == cur[i]:
+            i += 1
+            continue
+        j = i + 1
+        while j < n:
+            if prev[j] != cur[j]:
+                j += 1
+            elif any(prev[k] != cur[k] for k in range(j, min(j + RUN_GAP, n))):
+                j += 1
+            else:
+                break
+        runs.append((i, j))
+        i = j
+    out = bytearray()
+    pos = 0
+    for start, end in runs:
+        while start - pos > 0xffff:
+            # too far to skip in one, copy a byte on the way
+            out += struct.pack('<HH', 0xffff, 1) + cur[pos + 0xffff:pos + 0x10000]
+            pos += 0x10000
+        while start < end:
+            length = min(end - start, 0xffff)
+            out += struct.pack('<HH', start - pos, length) + cur[start:start + length]
+            start += length
+            pos = start
+    return bytes(out + struct.pack('<HH', 0, 0))
+
+
+def rgb565(frame):
+    return [(r & 0xf8) << 8 | (g & 0xfc) << 3 | b >> 3
+            for row in frame for r, g, b in row]
+
+
+def read_ppm(name):
+    with open(name, 'rb') as f:
+        data = f.read()
+    if not data.startswith(b'P6'):
+        raise ValueError('%s: not a binary PPM file' % name)
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b'P6' or fields[3] != b'255':
+        raise ValueError('%s: only 8 bit binary PPM files' % name)
+    w, h = int(fields[1]), int(fields[2])
+    pix = data[pos + 1:pos + 1 + w * h * 3]
+    return [(w, h, [[tuple(pix[(y * w + x) * 3:(y * w + x) * 3 + 3])
+                     for x in range(w)] for y in range(h)])]
+
+
+def read_image(name):
+    """Every frame of an image file as (width, height, rows)."""
+    try:
+        return read_ppm(name)
+    except ValueError:
+        pass
+    from PIL import Image, ImageSequence
+    out = []
+    for im in ImageSequence.Iterator(Image.open(name)):
+        im = im.convert('RGB')
+        iw, ih = im.size
+        out.append((iw, ih, [[im.getpixel((x, y)) for x in range(iw)]
+                             for y in range(ih)]))
+    return out
+
+
+def gif_fps(name):
+    try:
+        from PIL import Image
+        ms = Image.open(name).info.get('duration')
+    except (ImportError, OSError):
+        return None
+    return max(1, round(1000.0 / ms)) if ms else None
+
+
+def fit(img, w, h):
+    # nearest neighbour to the frame buffer size
+    iw, ih, rows = img
+    return [[rows[y * ih // h][x * iw // w] for x in range(w)]
+            for y in range(h)]
+
+
+def spinner(w, h, n=12):
+    # a ring of dots with a comet tail going round, clockwise
+    frames = []
+    cx, cy, rad, dot = w / 2.0, h / 2.0, min(w, h) * 0.3, min(w, h) / 16.0
+    for f in range(n):
+        rows = [[(0, 0, 0)] * w for _ in range(h)]
+        for d in range(n):
+            age = (f - d) % n
+            lvl = max(0.0, 1.0 - age / 6.0) if age else 1.0
+            lvl = max(lvl, 0.08)
+            a = 2 * math.pi * d / n
+            x0, y0 = cx + rad * math.sin(a), cy - rad * math.cos(a)
+            col = (0, int(255 * lvl), int(255 * lvl)) if age else (255, 255, 255)
+            for y in range(int(y0 - dot), int(y0 + dot) + 2):
+                for x in range(int(x0 - dot), int(x0 + dot) + 2):
+                    if ((0 <= x < w and 0 <= y < h) and
+                            (x + 0.5 - x0) ** 2 + (y + 0.5 - y0) ** 2 <= dot * dot):
+                        rows[y][x] = col
+        frames.append(rows)
+    return frames
+
+
+PATTERNS = {'spinner': spinner}
+
+
+def c_file(path, name, what, geo, depth, flags, frames, fps, data):
+    lines = [
+        '/*',
+        ' * %s -- %s, written by tools/hub75_anim.py' % (os.path.basename(path), what),
+        ' *',
+        ' * %d frames at %d frames a second, %d bits deep, for %dx%d with' %
+        (frames, fps, depth, geo.width, geo.height),
+        ' * %d scan rows of %d clocks. Do not edit, bake it again.' %
+        (geo.scan, geo.plane_len),
+        ' */',
+        '',
+        '#include <stdint.h>',
+        '#include "../util/hub75.h"',
+        '',
+        'static const uint8_t %s_data[%d] = {' % (name, len(data)),
+    ]
+    for i in range(0, len(data), 12):
+        lines.append('\t' + ' '.join('0x%02x,' % b for b in data[i:i + 12]))
+    lines += [
+        '};',
+        '',
+        'const struct hub75_anim %s = {' % name,
+        '\t%d, %d, %d, %s, %d, %d, sizeof(%s_data), %s_data' %
+        (geo.scan, geo.plane_len, depth,
+         'HUB75_ANIM_DELTA' if flags else '0', frames, fps, name, name),
+        '};',
+    ]
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def parse_geometry(args, ap):
+    if args.demo:
+        w, h, pw, ph, scan, chain, chains, panels = DEMOS[args.demo]
+    else:
+        w, h, pw, ph, scan, chain, chains, panels = 64, 64, 64, 32, 16, 2, 1, None
+    try:
+        if args.size:
+            w, h = (int(v) for v in args.size.split('x'))
+        if args.panel:
+            pw, ph = (int(v) for v in args.panel.split('x'))
+        if args.panels is not None:
+            panels = [tuple(int(v) for v in p.split(','))
+                      for p in args.panels.split(';') if p]
+    except ValueError:
+        ap.error('--size and --panel are WxH, --panels is x,y,flags;...')
+    scan = args.scan or scan
+    chain = args.chain or chain
+    chains = args.chains or chains
+    if ph != 2 * scan or scan not in (8, 16, 32):
+        ap.error('a panel is two scans high, and a scan is 8, 16 or 32 rows')
+    if panels and len(panels) != chain * chains:
+        ap.error('--panels needs one for each panel of each chain')
+    return Geometry(w, h, pw, ph, scan, chain, chains, panels)
+
+
+def main():
+    host = Host()
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description='Bake an animation for hub75_bcm_play()')
+    ap.add_argument('images', nargs='*',
+                    help='a GIF, or PNG/PPM files one frame each')
+    ap.add_argument('--pattern', choices=sorted(PATTERNS),
+                    help='bake a built in pattern instead')
+    ap.add_argument('--frames', type=int, default=12,
+                    help='frames of the pattern (%(default)s)')
+    ap.add_argument('--demo', choices=sorted(DEMOS),
+                    help='the geometry of this demo, and write it there')
+    ap.add_argument('--size', help='frame buffer WxH')
+    ap.add_argument('--panel', help='panel WxH')
+    ap.add_argument('--scan', type=int, help='rows scanned')
+    ap.add_argument('--chain', type=int, help='panels in a chain')
+    ap.add_argument('--chains', type=int, help='chains clocked in parallel')
+    ap.add_argument('--panels', help='each panel as x,y,flags;... '
+                    '(flags 1 flip x, 2 flip y, 4 swap)')
+    ap.add_argument('--depth', type=int, default=4,
+                    help='bits, the depth the engine will run at (%(default)s)')
+    ap.add_argument('--gamma', type=float, default=host.DEFAULT_GAMMA)
+    ap.add_argument('--fps', type=int, help='frames a second (the GIF\'s, or 12)')
+    ap.add_argument('--raw', action='store_true',
+                    help='store whole frames rather than changes')
+    ap.add_argument('--name', help='of the struct hub75_anim (the file\'s)')
+    ap.add_argument('-o', '--output', help='C file to write')
+    args = ap.parse_args()
+
+    geo = parse_geometry(args, ap)
+    if not host.geometry(geo):
+        ap.error('hub75_init() would turn this geometry down')
+    if not 1 <= args.depth <= host.MAX_DEPTH:
+        ap.error('--depth is 1 to %d' % host.MAX_DEPTH)
+    if bool(args.pattern) == bool(args.images):
+        ap.error('give images or a --pattern')
+    if args.pattern:
+        frames = PATTERNS[args.pattern](geo.width, geo.height, args.frames)
+        what = 'the %s pattern' % args.pattern
+        fps = args.fps or 12
+    else:
+        imgs = [img for name in args.images for img in read_image(name)]
+        frames = [fit(img, geo.width, geo.height) for img in imgs]
+        what = ', '.join(os.path.basename(n) for n in args.images)
+        fps = args.fps or gif_fps(args.images[0]) or 12
+    if not 0 < len(frames) <= 0xffff:
+        ap.error('1 to 65535 frames')
+    name = args.name or args.pattern or \
+        os.path.splitext(os.path.basename(args.images[0]))[0]
+    out = args.output
+    if out is None:
+        out = os.path.join(here, '..', 'demos', args.demo, name + '.c') \
+            if args.demo else name + '.c'
+
+    host.bcm(args.depth, args.gamma)
+    planes = [host.frame(rgb565(f)) for f in frames]
+    size = len(planes[0])
+    if args.raw:
+        data = b''.join(planes)
+    else:
+        # black to the first, each to the next, the last to the first
+        prev = [bytes(size)] + planes
+        data = b''.join(delta(a, b) for a, b in zip(prev, planes + planes[:1]))
+        check = bytearray(size)
+        pos = 0
+        for p in planes + planes[:1]:
+            pos = host.apply(geo.scan, geo.plane_len, args.depth, data, check, pos)
+            if pos < 0 or check != p:
+                print('delta encoding went wrong', file=sys.stderr)
+                return 1
+    c_file(out, name, what, geo, args.depth, 0 if args.raw else 1,
+           len(frames), fps, data)
+    print('wrote %s: %d frames of %d bytes in %d (%.1f%%)'
+          % (os.path.normpath(out), len(frames), size, len(data),
+             100.0 * len(data) / (size * len(frames))))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
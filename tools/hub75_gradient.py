@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# hub75_gradient.py -- render ramps the way the BCM engine shows them
+#
+# Runs ramps of white, red, green and blue through what hub75.c does to
+# each pixel: RGB565, the gamma table, then bcm_levels() rounding to
+# the BCM depth, or with dithering carrying the part below the depth
+# over to the next frame. The gamma table and bcm_levels() are hub75.c's
+# own, built for the host by hub75_host.py. Each ramp is drawn in four
+# bands:
+#
+#	the ramp as drawn (RGB565)
+#	what the panel shows at the depth without dithering
+#	one frame of it with dithering
+#	the average of 16 dithered frames, which is what the eye sees
+#
+# The panel's light is linear, so to look right on a PC screen each band
+# is taken back through the inverse of the gamma: the closer a band is
+# to the first, the better. It also prints how many distinct steps each
+# band has and how far it is off the ramp.
+#
+# Writes a binary PPM, or a PNG if the name ends in .png and PIL is
+# there.
+#
+
+import argparse
+import sys
+
+from hub75_host import Host
+
+DITHER_FRAMES = 16
+RAMPS = [('white', (1, 1, 1)), ('red', (1, 0, 0)),
+         ('green', (0, 1, 0)), ('blue', (0, 0, 1))]
+
+
+def main():
+    host = Host()
+    ap = argparse.ArgumentParser(description='Render ramps as the BCM engine shows them')
+    ap.add_argument('--depth', type=int, default=4, help='BCM bits (%(default)s)')
+    ap.add_argument('--gamma', type=float, default=round(host.DEFAULT_GAMMA, 3))
+    ap.add_argument('--width', type=int, default=256, help='of the ramps (%(default)s)')
+    ap.add_argument('--band', type=int, default=16, help='pixels high (%(default)s)')
+    ap.add_argument('-o', '--output', default='gradient.ppm')
+    args = ap.parse_args()
+    if not 1 <= args.depth <= host.MAX_DEPTH:
+        ap.error('--depth is 1 to %d' % host.MAX_DEPTH)
+
+    full = (1 << host.GAMMA_BITS) - 1
+    scale = float(1 << (host.GAMMA_BITS - args.depth))
+
+    def seen(level):
+        # linear light back to what a PC screen needs to look the same
+        return int(255 * min(1.0, level * scale / full) ** (1 / args.gamma) + 0.5)
+
+    rows = []
+    print('depth %d, gamma %.1f: distinct steps, largest error (of 255)'
+          % (args.depth, args.gamma))
+    for name, on in RAMPS:
+        bands = [[], [], [], []]
+        for x in range(args.width):
+            v = x * 255 // (args.width - 1)
+            r, g, b = (v * k for k in on)
+            pix = (r & 0xf8) << 8 | (g & 0xfc) << 3 | b >> 3
+            # the RGB565 value as drawn, back to 8 bits
+            bands[0].append(((pix >> 11) * 255 // 31, ((pix >> 5) & 0x3f) * 255 // 63,
+                             (pix & 0x1f) * 255 // 31))
+            host.bcm(args.depth, args.gamma, False)
+            lv, _ = host.levels(pix)
+            bands[1].append(tuple(seen(c) for c in lv))
+            # a pixel starts with no error, the middle frame of the run
+            host.bcm(args.depth, args.gamma, True)
+            err, total = 0, [0, 0, 0]
+            for f in range(DITHER_FRAMES):
+                lv, err = host.levels(pix, err)
+                if f == DITHER_FRAMES // 2:
+                    bands[2].append(tuple(seen(c) for c in lv))
+                total = [t + c for t, c in zip(total, lv)]
+            bands[3].append(tuple(seen(t / float(DITHER_FRAMES)) for t in total))
+        ch = on.index(1)
+        stats = []
+        for band in bands:
+            steps = len(set(p[ch] for p in band))
+            worst = max(abs(p[ch] - q[ch]) for p, q in zip(band, bands[0]))
+            stats.append('%3d %3d' % (steps, worst))
+        print('%-6s drawn %s, plain %s, one dithered frame %s, averaged %s'
+              % (name, *stats))
+        for band in bands:
+            rows += [band] * args.band
+
+    w, h = args.width, len(rows)
+    if args.output.endswith('.png'):
+        try:
+            from PIL import Image
+        except ImportError:
+            print('no PIL, can\'t write PNG', file=sys.stderr)
+            return 1
+        img = Image.new('RGB', (w, h))
+        img.putdata([p for row in rows for p in row])
+        img.save(args.output)
+    else:
+        with open(args.output, 'wb') as f:
+            f.write(b'P6\n%d %d\n255\n' % (w, h))
+            f.write(bytes(c for row in rows for p in row for c in p))
+    print('wrote %s, %dx%d' % (args.output, w, h))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+#
+# hub75_host.py -- the BCM encoder of demos/util/hub75.c, built for the host
+#
+# Takes the parts of hub75.c that turn a frame buffer into bit-planes
+# out of the source as they are: check_geometry(), scan_tables() and
+# build_spans() for the panel mapping, hub75_bcm_gamma() for the gamma
+# tables, bcm_levels() and bcm_encode(), bcm_advance() for the order
+# the planes go out in, hub75_pair_bsrr[] and hub75_pair_bsrr_pa[] for
+# the BSRR words, and anim_apply() for baked animations' changes. With the static variables they use (declared as
+# hub75.c declares them) and a small wrapper, they are built into a
+# shared library and loaded with ctypes.
+#
+# hub75_sim.py, hub75_gradient.py and hub75_anim.py all encode with
+# it, so what they check, show or bake is what the engine does.
+#
+# Run on its own it builds the library and prints what it found.
+#
+
+import ctypes
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+UTIL = os.path.join(HERE, '..', 'demos', 'util')
+
+# in the order they are in hub75.c
+FUNCS = ['bcm_advance', 'bcm_levels', 'pixel_src', 'bcm_encode', 'anim_apply',
+         'chain_panel',
+         'panel_offset', 'build_spans', 'check_geometry', 'scan_tables',
+         'hub75_bcm_gamma', 'hub75_bcm_dither']
+STATICS = ['spans', 'scan_rows', 'scan_clocks', 'scan_chain', 'scan_ports',
+           'plane_len', 'scan_width', 'planes', 'gamma5', 'gamma6', 'cur_gamma',
+           'dither', 'dither_err', 'cur_fb', 'stale', 'row_mask', 'fb_width',
+           'fb_height', 'rehash', 'row_src', 'fb_swapped', 'depth', 'anim',
+           'anim_pos']
+
+PRELUDE = r'''
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* libopencm3's, for the pins in hub75.h */
+#define GPIO(n)		(1 << (n))
+%s
+#define CCM_DATA
+#include "hub75.h"
+'''
+
+WRAPPER = r'''
+static struct hub75_geometry	host_geo;
+static struct hub75_panel	host_panels[HUB75_MAX_CHAIN * HUB75_MAX_CHAINS];
+
+const int host_gamma_bits = GAMMA_BITS;
+const int host_max_depth = HUB75_MAX_DEPTH;
+const int host_default_unit = HUB75_DEFAULT_UNIT;
+const int host_brightness_max = HUB75_BRIGHTNESS_MAX;
+const int host_max_clocks = HUB75_MAX_CLOCKS;
+const int host_dma_period = HUB75_DMA_PERIOD;
+const float host_default_gamma = HUB75_DEFAULT_GAMMA;
+const uint32_t host_pins[2][6] = {
+	{ HUB75_R1, HUB75_G1, HUB75_B1, HUB75_R2, HUB75_G2, HUB75_B2 },
+	{ HUB75_PA_R1, HUB75_PA_G1, HUB75_PA_B1, HUB75_PA_R2, HUB75_PA_G2, HUB75_PA_B2 }
+};
+
+/*
+ * 'gv' is width, height, panel width, height, scan, chain, chains and
+ * 'pv' x, y, flags of each panel, or NULL. As hub75_init() but for the
+ * hardware, returns the clocks in a plane or -1.
+ */
+int
+host_geometry(const int *gv, const int *pv)
+{
+	int		i, ports;
+
+	host_geo.width = gv[0];
+	host_geo.height = gv[1];
+	host_geo.panel_width = gv[2];
+	host_geo.panel_height = gv[3];
+	host_geo.scan = gv[4];
+	host_geo.chain = gv[5];
+	host_geo.chains = gv[6];
+	host_geo.panels = NULL;
+	ports = (host_geo.chains) ? host_geo.chains : 1;
+	if ((ports < 1) || (ports > HUB75_MAX_CHAINS) ||
+		(host_geo.chain < 1) || (host_geo.chain > HUB75_MAX_CHAIN)) {
+		return -1;
+	}
+	if (pv) {
+		for (i = 0; i < ports * host_geo.chain; i++) {
+			host_panels[i].x = pv[i * 3];
+			host_panels[i].y = pv[i * 3 + 1];
+			host_panels[i].flags = pv[i * 3 + 2];
+		}
+		host_geo.panels = host_panels;
+	}
+	if (check_geometry(&host_geo, ports) < 0) {
+		return -1;
+	}
+	scan_tables(&host_geo, ports);
+	memset(dither_err, 0, sizeof(dither_err));
+	return plane_len;
+}
+
+/* What hub75_bcm_start(), hub75_bcm_gamma() and hub75_bcm_dither() set */
+void
+host_bcm(int d, float g, int on)
+{
+	depth = d;
+	hub75_bcm_gamma(g);
+	hub75_bcm_dither(on);
+}
+
+/* Encode scan row 'row' of 'fb', and copy out its 'depth' planes */
+void
+host_encode(const uint16_t *fb, int row, uint8_t *out)
+{
+	cur_fb = (uint16_t *) fb;
+	bcm_encode(row);
+	memcpy(out, &planes[row * depth * plane_len], depth * plane_len);
+}
+
+void
+host_levels(uint32_t pix, uint16_t *err, uint32_t *lv)
+{
+	bcm_levels(pix, err, lv);
+}
+
+void
+host_advance(int *row, int *bit)
+{
+	bcm_advance(row, bit);
+}
+
+/*
+ * anim_apply() of the changes at 'pos' in 'a' to the planes in 'buf'
+ * (a whole frame), returns where the next frame's start or -1.
+ */
+int
+host_apply(const struct hub75_anim *a, uint32_t pos, uint8_t *buf)
+{
+	uint32_t	size = a->rows * a->depth * a->clocks;
+
+	memcpy(planes, buf, size);
+	anim = a;
+	anim_pos = pos;
+	if (anim_apply() < 0) {
+		return -1;
+	}
+	memcpy(buf, planes, size);
+	return anim_pos;
+}
+
+void
+host_gamma(uint16_t *g5, uint16_t *g6)
+{
+	memcpy(g5, gamma5, sizeof(gamma5));
+	memcpy(g6, gamma6, sizeof(gamma6));
+}
+'''
+
+
+def extract(src):
+    """The parts of hub75.c the host build needs, in its order."""
+    parts = [re.search(r'^struct hub75_span \{.*?^\};\n', src, re.S | re.M).group(0)]
+    m = re.search(r'^#define PAIR_BITS.*?^const uint32_t hub75_pair_bsrr_pa\[64\] = \{.*?^\};\n',
+                  src, re.S | re.M)
+    if not m:
+        raise ValueError('no hub75_pair_bsrr tables in hub75.c')
+    parts.append(m.group(0))
+    parts.append(re.search(r'^#define GAMMA_BITS.*\n', src, re.M).group(0))
+    for name in STATICS:
+        m = re.search(r'^static [^(\n]*\b%s\b[^(\n]*;' % name, src, re.M)
+        if not m:
+            raise ValueError('no static %s in hub75.c' % name)
+        parts.append(m.group(0) + '\n')
+    funcs = []
+    for name in FUNCS:
+        m = re.search(r'^[a-z][^\n;]*\n%s\(.*?^\}\n' % name, src, re.S | re.M)
+        if not m:
+            raise ValueError('no %s() in hub75.c' % name)
+        funcs.append((m.start(), m.group(0)))
+    parts += [f for _, f in sorted(funcs)]
+    return '\n'.join(parts)
+
+
+class Anim(ctypes.Structure):
+    """struct hub75_anim"""
+    _fields_ = [('rows', ctypes.c_uint16), ('clocks', ctypes.c_uint16),
+                ('depth', ctypes.c_uint8), ('flags', ctypes.c_uint8),
+                ('frames', ctypes.c_uint16), ('fps', ctypes.c_uint16),
+                ('bytes', ctypes.c_uint32), ('data', ctypes.POINTER(ctypes.c_uint8))]
+
+
+class Host:
+    """hub75.c's encoder, from the source in the tree."""
+
+    def __init__(self):
+        with open(os.path.join(UTIL, 'hub75.c')) as f:
+            code = extract(f.read())
+        pins = '\n'.join('#define GPIO%d\t\tGPIO(%d)' % (i, i) for i in range(16))
+        tmp = tempfile.mkdtemp()
+        try:
+            src = os.path.join(tmp, 'host.c')
+            with open(src, 'w') as f:
+                f.write(PRELUDE % pins + code + WRAPPER)
+            lib = os.path.join(tmp, 'host.so')
+            r = subprocess.run(['cc', '-O2', '-Wall', '-Wno-unused-variable',
+                                '-Wno-unused-function', '-shared', '-fPIC',
+                                '-I', UTIL, '-o', lib, src, '-lm'],
+                               capture_output=True, text=True)
+            if r.returncode:
+                raise RuntimeError('hub75.c didn\'t build for the host:\n' + r.stderr)
+            self.lib = ctypes.CDLL(lib)
+        finally:
+            shutil.rmtree(tmp)
+
+        def const(name, kind=ctypes.c_int):
+            return kind.in_dll(self.lib, name).value
+        self.GAMMA_BITS = const('host_gamma_bits')
+        self.MAX_DEPTH = const('host_max_depth')
+        self.DEFAULT_UNIT = const('host_default_unit')
+        self.BRIGHTNESS_MAX = const('host_brightness_max')
+        self.MAX_CLOCKS = const('host_max_clocks')
+        self.DMA_PERIOD = const('host_dma_period')
+        self.DEFAULT_GAMMA = const('host_default_gamma', ctypes.c_float)
+        # pin numbers of R1, G1, B1, R2, G2, B2 on GPIOB, and on GPIOA
+        pins = (ctypes.c_uint32 * 12).in_dll(self.lib, 'host_pins')
+        self.pins = [dict(zip(('R1', 'G1', 'B1', 'R2', 'G2', 'B2'),
+                              (m.bit_length() - 1 for m in pins[k * 6:k * 6 + 6])))
+                     for k in range(2)]
+        self.pair_bsrr = list((ctypes.c_uint32 * 64).in_dll(self.lib, 'hub75_pair_bsrr'))
+        self.pair_bsrr_pa = list((ctypes.c_uint32 * 64).in_dll(self.lib, 'hub75_pair_bsrr_pa'))
+        self.lib.host_bcm.argtypes = [ctypes.c_int, ctypes.c_float, ctypes.c_int]
+        self.depth = 0
+        self.plane_len = 0
+        self.scan = 0
+
+    def geometry(self, geo):
+        """Set up the scan for a hub75_anim.Geometry, False if it won't work."""
+        gv = (ctypes.c_int * 7)(geo.width, geo.height, geo.panel_width,
+                                geo.panel_height, geo.scan, geo.chain, geo.chains)
+        pv = None
+        if geo.panels:
+            pv = (ctypes.c_int * (len(geo.panels) * 3))(*[v for p in geo.panels for v in p])
+        n = self.lib.host_geometry(gv, pv)
+        if n < 0:
+            return False
+        self.plane_len, self.scan = n, geo.scan
+        return True
+
+    def bcm(self, depth, gamma, dither=False):
+        self.depth = depth
+        self.lib.host_bcm(depth, gamma, 1 if dither else 0)
+
+    def encode(self, fb, row):
+        """bcm_encode() of scan row 'row' of 'fb' (a ctypes array from
+        frame_buffer()), its 'depth' planes."""
+        out = (ctypes.c_uint8 * (self.depth * self.plane_len))()
+        self.lib.host_encode(fb, row, out)
+        raw = bytes(out)
+        return [raw[i * self.plane_len:(i + 1) * self.plane_len] for i in range(self.depth)]
+
+    def frame(self, fb):
+        """Every row's planes, laid out as in the engine's planes[]."""
+        fb = self.frame_buffer(fb)
+        return b''.join(p for row in range(self.scan) for p in self.encode(fb, row))
+
+    @staticmethod
+    def frame_buffer(pixels):
+        if isinstance(pixels, ctypes.Array):
+            return pixels
+        return (ctypes.c_uint16 * len(pixels))(*pixels)
+
+    def levels(self, pix, err=0):
+        """bcm_levels(), the R, G, B levels and the dither error after."""
+        e = ctypes.c_uint16(err)
+        lv = (ctypes.c_uint32 * 3)()
+        self.lib.host_levels(pix, ctypes.byref(e), lv)
+        return list(lv), e.value
+
+    def apply(self, rows, clocks, depth, data, planes, pos):
+        """anim_apply() of the changes at 'pos' in 'data' to 'planes' (a
+        bytearray), returns where the next frame's are or -1."""
+        raw = (ctypes.c_uint8 * len(data)).from_buffer_copy(data)
+        a = Anim(rows, clocks, depth, 1, 0, 0, len(data), raw)
+        buf = (ctypes.c_uint8 * len(planes)).from_buffer(planes)
+        return self.lib.host_apply(ctypes.byref(a), pos, buf)
+
+    def advance(self, row, bit):
+        r, b = ctypes.c_int(row), ctypes.c_int(bit)
+        self.lib.host_advance(ctypes.byref(r), ctypes.byref(b))
+        return r.value, b.value
+
+    def gamma_tables(self):
+        g5, g6 = (ctypes.c_uint16 * 32)(), (ctypes.c_uint16 * 64)()
+        self.lib.host_gamma(g5, g6)
+        return list(g5), list(g6)
+
+
+def main():
+    host = Host()
+    host.bcm(host.MAX_DEPTH, host.DEFAULT_GAMMA)
+    g5, g6 = host.gamma_tables()
+    print('hub75.c built for the host: GAMMA_BITS %d, depth to %d, gamma %.1f '
+          '(5 bit %d..%d, 6 bit %d..%d)' % (host.GAMMA_BITS, host.MAX_DEPTH,
+                                          host.DEFAULT_GAMMA, g5[1], g5[31],
+                                          g6[1], g6[63]))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
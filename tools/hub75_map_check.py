@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+#
+# hub75_map_check.py -- check the panel pixel mapping of hub75.c
+#
+# Takes build_spans(), panel_offset() and chain_panel() out of
+# demos/util/hub75.c as they are, builds them for the host and runs
+# them for each geometry below: the demos' own (leds has a panel
+# mounted upside down, HUB75_ROT_180, led2 one with its rows the other
+# way up, HUB75_FLIP_Y), four panels in one chain, in a line and in a
+# two by two square, two chains in parallel (as leds with
+# PARALLEL_CHAINS, and of four panels each) and a panel on its side.
+#
+# For each it checks that:
+#  - the pixels clocked in cover every frame buffer pixel under a
+#    panel exactly once, and nothing else,
+#  - row_mask[] marks exactly the scan rows that read each frame
+#    buffer row,
+#  - some landmark pixels land where the panels' placement says, e.g.
+#    the first pixel clocked into leds' upside down panel is the
+#    bottom right of the top half of the frame buffer.
+#
+# Exits 1 if any of that is wrong.
+#
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+FLIP_X, FLIP_Y, SWAP_XY = 1, 2, 4
+ROT_90, ROT_180 = FLIP_Y | SWAP_XY, FLIP_X | FLIP_Y
+
+PRELUDE = r'''
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "hub75.h"
+
+%s
+static struct hub75_span spans[32 * HUB75_MAX_CHAIN * HUB75_MAX_CHAINS];
+static uint32_t row_mask[HUB75_MAX_HEIGHT];
+static int fb_swapped;
+
+%s
+/* w h panel_w panel_h scan chain chains, then x y flags of each panel */
+int
+main(int argc, char **argv)
+{
+	struct hub75_geometry	g;
+	struct hub75_panel		pn[HUB75_MAX_CHAIN * HUB75_MAX_CHAINS];
+	int		i, n, ports;
+
+	g.width = atoi(argv[1]);
+	g.height = atoi(argv[2]);
+	g.panel_width = atoi(argv[3]);
+	g.panel_height = atoi(argv[4]);
+	g.scan = atoi(argv[5]);
+	g.chain = atoi(argv[6]);
+	g.chains = atoi(argv[7]);
+	ports = (g.chains) ? g.chains : 1;
+	g.panels = NULL;
+	if (argc > 8) {
+		for (i = 0; i < ports * g.chain; i++) {
+			pn[i].x = atoi(argv[8 + i * 3]);
+			pn[i].y = atoi(argv[9 + i * 3]);
+			pn[i].flags = atoi(argv[10 + i * 3]);
+		}
+		g.panels = pn;
+	}
+	build_spans(&g, ports);
+	n = g.scan * ports * g.chain;
+	for (i = 0; i < n; i++) {
+		printf("%%d %%d %%d\n", spans[i].top, spans[i].bot, spans[i].step);
+	}
+	for (i = 0; i < g.height; i++) {
+		printf("%%u\n", (unsigned) row_mask[i]);
+	}
+	printf("%%d\n", fb_swapped);
+	return 0;
+}
+'''
+
+# name: (width, height, panel w, h, scan, chain, chains, panels or None,
+#        landmarks: (scan row, bottom half, chain, clock) -> frame buffer x, y)
+GEOMETRIES = {
+    'leds, ROT_180 above a plain panel': (
+        64, 64, 64, 32, 16, 2, 1, [(0, 32, 0), (0, 0, ROT_180)], {
+            (0, 0, 0, 0): (63, 31),     # first in, the far (upside down) panel
+            (0, 0, 0, 63): (0, 31),
+            (0, 1, 0, 0): (63, 15),
+            (15, 1, 0, 63): (0, 0),
+            (0, 0, 0, 64): (0, 32),     # then the one plugged into the board
+            (15, 1, 0, 127): (63, 63),
+        }),
+    'led2, FLIP_Y': (
+        64, 64, 64, 64, 32, 1, 1, [(0, 0, FLIP_Y)], {
+            (0, 0, 0, 0): (0, 63),
+            (0, 1, 0, 0): (0, 31),
+            (31, 1, 0, 63): (63, 0),
+        }),
+    'four panels in a line': (
+        256, 32, 64, 32, 16, 4, 1, None, {
+            (0, 0, 0, 0): (192, 0),
+            (0, 0, 0, 64): (128, 0),
+            (0, 0, 0, 255): (63, 0),
+            (15, 1, 0, 0): (192, 31),
+        }),
+    'four panels, two by two, the top two upside down': (
+        128, 64, 64, 32, 16, 4, 1,
+        [(0, 32, 0), (64, 32, 0), (64, 0, ROT_180), (0, 0, ROT_180)], {
+            (0, 0, 0, 0): (63, 31),
+            (0, 0, 0, 64): (127, 31),
+            (0, 0, 0, 128): (64, 32),
+            (0, 0, 0, 192): (0, 32),
+            (15, 1, 0, 255): (63, 63),
+        }),
+    'two chains of two': (
+        128, 64, 64, 32, 16, 2, 2, None, {
+            (0, 0, 0, 0): (64, 0),
+            (0, 0, 0, 127): (63, 0),
+            (0, 0, 1, 0): (64, 32),
+            (15, 1, 1, 127): (63, 63),
+        }),
+    'leds with PARALLEL_CHAINS, a panel on each': (
+        64, 64, 64, 32, 16, 1, 2, None, {
+            (0, 0, 0, 0): (0, 0),
+            (0, 0, 1, 0): (0, 32),
+            (15, 1, 1, 63): (63, 63),
+        }),
+    'eight panels, two chains of four': (
+        256, 64, 64, 32, 16, 4, 2, None, {
+            (0, 0, 0, 0): (192, 0),
+            (0, 0, 1, 0): (192, 32),
+            (15, 1, 1, 255): (63, 63),
+        }),
+    'a panel on its side, ROT_90': (
+        32, 64, 64, 32, 16, 1, 1, [(0, 0, ROT_90)], {
+            (0, 0, 0, 0): (31, 0),
+            (0, 0, 0, 63): (31, 63),
+            (0, 1, 0, 0): (15, 0),
+            (15, 1, 0, 0): (0, 0),
+        }),
+}
+
+
+def extract(src):
+    out = [re.search(r'^struct hub75_span \{.*?^\};\n', src, re.S | re.M).group(0)]
+    funcs = []
+    for name in ('chain_panel', 'panel_offset', 'build_spans'):
+        m = re.search(r'^static [^\n]*\n%s\(.*?^\}\n' % name, src, re.S | re.M)
+        if not m:
+            raise ValueError('no %s() in hub75.c' % name)
+        funcs.append(m.group(0))
+    return out[0], '\n'.join(funcs)
+
+
+def check(drv, name, geo):
+    w, h, pw, ph, scan, chain, chains, panels, marks = geo
+    argv = [drv] + [str(v) for v in (w, h, pw, ph, scan, chain, chains)]
+    if panels:
+        argv += [str(v) for p in panels for v in p]
+    out = subprocess.run(argv, capture_output=True, text=True,
+                         check=True).stdout.split('\n')
+    n = scan * chains * chain
+    spans = [tuple(int(v) for v in line.split()) for line in out[:n]]
+    mask = [int(v) for v in out[n:n + h]]
+    swapped = int(out[n + h])
+    errors = []
+
+    hits = {}
+    reads = [0] * h
+    for i, (top, bot, step) in enumerate(spans):
+        row, rest = divmod(i, chains * chain)
+        k, j = divmod(rest, chain)
+        for x in range(pw):
+            for half, base in enumerate((top, bot)):
+                off = base + x * step
+                if not 0 <= off < w * h:
+                    errors.append('row %d chain %d clock %d: offset %d is outside'
+                                  % (row, k, j * pw + x, off))
+                    continue
+                hits.setdefault(off, []).append((row, half, k, j * pw + x))
+                reads[off // w] |= 1 << row
+    if errors:
+        return errors
+
+    # the area under the panels, from their placement alone
+    if not panels:
+        panels = [(j * pw, k * ph, 0) for k in range(chains) for j in range(chain)]
+    area = set()
+    for x0, y0, flags in panels:
+        aw, ah = (ph, pw) if flags & SWAP_XY else (pw, ph)
+        area |= {(y0 + y) * w + x0 + x for y in range(ah) for x in range(aw)}
+    for off, who in sorted(hits.items()):
+        if len(who) > 1:
+            errors.append('(%d, %d) is clocked %d times' % (off % w, off // w, len(who)))
+    missed = area - set(hits)
+    extra = set(hits) - area
+    if missed:
+        off = min(missed)
+        errors.append('%d pixels under a panel never clocked, e.g. (%d, %d)'
+                      % (len(missed), off % w, off // w))
+    if extra:
+        off = min(extra)
+        errors.append('%d pixels clocked that aren\'t under a panel, e.g. (%d, %d)'
+                      % (len(extra), off % w, off // w))
+    for y in range(h):
+        if mask[y] != reads[y]:
+            errors.append('row_mask[%d] is %08x, scan rows %08x read it'
+                          % (y, mask[y], reads[y]))
+            break
+    if bool(swapped) != any(p[2] & SWAP_XY for p in panels):
+        errors.append('fb_swapped is %d' % swapped)
+    where = {v: off for off, who in hits.items() for v in who}
+    for (row, half, k, clock), (x, y) in sorted(marks.items()):
+        off = where.get((row, half, k, clock))
+        if off != y * w + x:
+            errors.append('scan row %d %s chain %d clock %d lands on %s, expected (%d, %d)'
+                          % (row, ('top', 'bottom')[half], k, clock,
+                             'nothing' if off is None else '(%d, %d)' % (off % w, off // w),
+                             x, y))
+    return errors
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    util = os.path.join(here, '..', 'demos', 'util')
+    with open(os.path.join(util, 'hub75.c')) as f:
+        struct, funcs = extract(f.read())
+    tmp = tempfile.mkdtemp()
+    try:
+        src = os.path.join(tmp, 'map.c')
+        with open(src, 'w') as f:
+            f.write(PRELUDE % (struct, funcs))
+        drv = os.path.join(tmp, 'map')
+        r = subprocess.run(['cc', '-O1', '-Wall', '-I', util, '-o', drv, src],
+                           capture_output=True, text=True)
+        if r.returncode:
+            print('the mapping code didn\'t build:\n' + r.stderr, file=sys.stderr)
+            return 1
+        failed = 0
+        for name, geo in GEOMETRIES.items():
+            errors = check(drv, name, geo)
+            print('%-50s %s' % (name, 'FAILED' if errors else 'ok'))
+            for e in errors[:10]:
+                print('  ' + e)
+            failed |= bool(errors)
+    finally:
+        shutil.rmtree(tmp)
+    return failed
+
+
+if __name__ == '__main__':
+    sys.exit(main())
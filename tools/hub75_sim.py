@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+#
+# hub75_sim.py -- check the BCM engine's output on a model of the panels
+#
+# Runs the encoder of demos/util/hub75.c itself, built for the host by
+# hub75_host.py: the gamma tables, bcm_levels() and bcm_encode() turn a
+# test frame into bit-planes over the spans build_spans() makes, and
+# hub75_pair_bsrr[] (and hub75_pair_bsrr_pa[] for a second chain) turn
+# those into BSRR words. What is modelled here is only what the code
+# can't run on the host: the order bcm_latch() with bcm_shift() (the
+# CPU) or bcm_prep() and the DMA stream send the planes out in (through
+# the C bcm_advance()), the OE pulse TIM3 gives each, and the panels, a
+# shift register per half of each chain, loaded on CLK, copied to the
+# LEDs on LAT, and lit for as long as OE is low on the row the address
+# pins select.
+#
+# Then it checks, from nothing but the pins:
+#  - each plane is a whole row of clocks, and each word sets or clears
+#    every data pin of its port and nothing else,
+#  - the rows are lit in order and every bit of every row once a
+#    frame,
+#  - each OE pulse is (unit << bit) * brightness / 255 TIM3 ticks,
+#    for the bit of the plane that is latched,
+#  - the light each LED gives over a frame (or, dithering, over 16) is
+#    what the frame buffer pixel it shows asks for, through the gamma
+#    table, which also checks the pixel mapping, and is close to the
+#    gamma curve itself.
+# It exits 1 if any of that is wrong, and says what.
+#
+# The geometry is one of the demos' or given as for hub75_anim.py.
+#
+
+import argparse
+import sys
+
+from hub75_anim import DEMOS, parse_geometry
+from hub75_host import Host
+
+TIM3_HZ = 84000000
+CPU_HZ = 168000000
+DITHER_FRAMES = 16              # the error nibble comes round in 16
+
+
+class Engine:
+    """
+    hub75.c's encoder, and the order bcm_latch(), bcm_shift(),
+    bcm_prep() and bcm_prime() send its planes out in.
+    """
+
+    def __init__(self, host, geo, depth, gamma, dither, dma, unit, brightness):
+        if not host.geometry(geo):
+            raise ValueError('hub75_init() would turn this geometry down')
+        host.bcm(depth, gamma, dither)
+        self.host, self.geo, self.depth, self.dma = host, geo, depth, dma
+        self.unit, self.brightness = unit, brightness
+        self.clocks = geo.panel_width * geo.chain
+        self.bsrr = (host.pair_bsrr, host.pair_bsrr_pa)
+        self.planes = {}
+
+    def plane(self, row, bit, fb):
+        # bcm_plane(), a static frame encoded at the start of each row
+        if bit == 0:
+            for i, p in enumerate(self.host.encode(fb, row)):
+                self.planes[row, i] = p
+        return self.planes[row, bit]
+
+    def words(self, code):
+        # what bcm_shift() writes, or bcm_prep() leaves for the DMA
+        ports = self.geo.chains
+        return [[self.bsrr[k][c] for c in code[k * self.clocks:(k + 1) * self.clocks]]
+                for k in range(ports)]
+
+    def advance(self, row, bit):
+        return self.host.advance(row, bit)
+
+    def run(self, frame, latches):
+        """
+        What is on the pins for 'latches' latches, as a list of
+        (words shifted in before it, row address, TIM3 ARR, CCR2).
+        """
+        frame = self.host.frame_buffer(frame)
+        out = []
+        shift_row = shift_bit = prep_row = prep_bit = 0
+        if self.dma:
+            # bcm_prime(), plane 0 goes out and plane 1 is prepared
+            dma_words = [self.words(self.plane(prep_row, prep_bit, frame)), None]
+            shifting = dma_words[0]
+            prep_row, prep_bit = self.advance(prep_row, prep_bit)
+            dma_words[1] = self.words(self.plane(prep_row, prep_bit, frame))
+            dma_buf = 1
+        else:
+            shifting = self.words(self.plane(shift_row, shift_bit, frame))
+        for _ in range(latches):
+            # bcm_latch()
+            slot = self.unit << shift_bit
+            arr = slot
+            ccr2 = slot + 1 - (slot * self.brightness) // self.host.BRIGHTNESS_MAX
+            out.append((shifting, shift_row, arr, ccr2))
+            if self.dma:
+                shift_row, shift_bit = prep_row, prep_bit
+                shifting = dma_words[dma_buf]
+                dma_buf ^= 1
+                prep_row, prep_bit = self.advance(prep_row, prep_bit)
+                dma_words[dma_buf] = self.words(self.plane(prep_row, prep_bit, frame))
+            else:
+                shift_row, shift_bit = self.advance(shift_row, shift_bit)
+                shifting = self.words(self.plane(shift_row, shift_bit, frame))
+        return out
+
+
+class Panels:
+    """The chains as the pins see them: shift registers, latches, OE."""
+
+    def __init__(self, geo, pins):
+        self.geo = geo
+        self.len = geo.panel_width * geo.chain
+        self.pins = pins[:geo.chains]
+        # the LEDs each chain's top and bottom half show, 3 bit colors
+        self.shown = [[[0] * self.len, [0] * self.len] for _ in self.pins]
+        self.light = [[0, 0, 0] for _ in range(geo.width * geo.height)]
+        self.errors = []
+
+    def shift(self, words):
+        # one port's BSRR words, each followed by a CLK pulse
+        for k, pins in enumerate(self.pins):
+            every = sum(1 << b for b in pins.values())
+            reg = [[], []]
+            for w in words[k]:
+                if (w & 0xffff) & (w >> 16) or ((w & 0xffff) | (w >> 16)) != every:
+                    self.errors.append('chain %d: BSRR word %08x doesn\'t set '
+                                       'exactly the data pins' % (k, w))
+                    return
+                for half, (r, g, b) in enumerate((('R1', 'G1', 'B1'),
+                                                  ('R2', 'G2', 'B2'))):
+                    reg[half].append((w >> pins[r] & 1) << 2 |
+                                     (w >> pins[g] & 1) << 1 | (w >> pins[b] & 1))
+            if len(words[k]) != self.len:
+                self.errors.append('chain %d: %d clocks for %d pixels'
+                                   % (k, len(words[k]), self.len))
+                return
+            # LAT, the first clocked in is the farthest along the chain
+            self.shown[k] = reg
+
+    def lit(self, row, ticks):
+        # OE low for 'ticks', row 'row' and 'row' + scan light up
+        geo = self.geo
+        for k in range(len(self.pins)):
+            for half in range(2):
+                for p in range(self.len):
+                    c = self.shown[k][half][p]
+                    if not c:
+                        continue
+                    # position p from the far end: panel, and its column
+                    j = geo.chain - 1 - p // geo.panel_width
+                    pn = geo.panels[k * geo.chain + j]
+                    off = geo.offset(pn, p % geo.panel_width, row + half * geo.scan)
+                    for ch in range(3):
+                        if c & (4 >> ch):
+                            self.light[off][ch] += ticks
+
+
+def test_frame(w, h):
+    # a gradient in each channel, so a pixel out of place shows
+    fb = []
+    for y in range(h):
+        for x in range(w):
+            r, g = x * 255 // (w - 1), y * 255 // (h - 1)
+            b = (x + y) * 255 // (w + h - 2)
+            fb.append((r & 0xf8) << 8 | (g & 0xfc) << 3 | b >> 3)
+    return fb
+
+
+def check(host, geo, args, dma):
+    eng = Engine(host, geo, args.depth, args.gamma, args.dither, dma, args.unit,
+                 args.brightness)
+    frame = test_frame(geo.width, geo.height)
+    frames = DITHER_FRAMES if args.dither else 1
+    per_frame = geo.scan * args.depth
+    panels = Panels(geo, host.pins)
+    errors = panels.errors
+    on = [((args.unit << i) * args.brightness) // host.BRIGHTNESS_MAX
+          for i in range(args.depth)]
+
+    # the first frame's planes are all out by its last latch
+    trace = eng.run(frame, frames * per_frame)
+    for n, (words, row, arr, ccr2) in enumerate(trace):
+        panels.shift(words)
+        want_row, want_bit = divmod(n % per_frame, args.depth)
+        if row != want_row:
+            errors.append('latch %d: row %d lit, expected %d' % (n, row, want_row))
+        # TIM3 one pulse, PWM2 inverted: OE low from CNT == CCR2 to ARR
+        ticks = max(0, arr - ccr2 + 1)
+        if arr != args.unit << want_bit or ticks != on[want_bit]:
+            errors.append('latch %d: row %d bit %d slot %d on %d, expected %d on %d'
+                          % (n, row, want_bit, arr, ticks, args.unit << want_bit,
+                             on[want_bit]))
+        panels.lit(row, ticks)
+        if len(errors) > 10:
+            break
+
+    # what each LED should have given: the level of its pixel, averaged
+    g5, g6 = host.gamma_tables()
+    bits = host.GAMMA_BITS
+    top = (1 << args.depth) - 1
+    s = bits - 4 - args.depth
+    worst = 0
+    # only the frame buffer pixels under a panel are shown
+    area = {geo.offset(pn, x, y) for pn in geo.panels
+            for y in range(geo.panel_height) for x in range(geo.panel_width)}
+    for off, pix in enumerate(frame):
+        if len(errors) > 10:
+            break
+        if off not in area:
+            if any(panels.light[off]):
+                errors.append('pixel (%d, %d) isn\'t under a panel but was lit'
+                              % (off % geo.width, off // geo.width))
+            continue
+        lin = (g5[pix >> 11], g6[(pix >> 5) & 0x3f], g5[pix & 0x1f])
+        for ch in range(3):
+            if args.dither:
+                # 16 frames of the level plus the carried error
+                want = lin[ch] >> s
+                lv, e = [], 0
+                for _ in range(frames):
+                    e += want
+                    lv.append(min(e >> 4, top))
+                    e &= 0xf
+            else:
+                lv = [min(((lin[ch] >> s) + 8) >> 4, top)] * frames
+            ticks = sum(on[i] for v in lv for i in range(args.depth) if v >> i & 1)
+            got = panels.light[off][ch]
+            if got != ticks:
+                errors.append('pixel (%d, %d) %s: lit %d ticks, expected %d'
+                              % (off % geo.width, off // geo.width, 'RGB'[ch],
+                                 got, ticks))
+            # and how far that is, on average, from the gamma curve itself
+            val = (pix >> 11, (pix >> 5) & 0x3f, pix & 0x1f)[ch]
+            exact = (val / (63.0 if ch == 1 else 31.0)) ** args.gamma * \
+                ((1 << bits) - 1) / (1 << (bits - args.depth))
+            if exact < top:
+                worst = max(worst, abs(sum(lv) / float(frames) - exact))
+    # rounding to the depth, or to 1/16 of it, and the table's own rounding
+    bound = (1 / 16.0 if args.dither else 0.5) + 0.5 / (1 << (bits - args.depth))
+    if worst > bound + 1e-6:
+        errors.append('off the gamma curve by %.3f of a step, expected at most %.3f'
+                      % (worst, bound))
+    return errors, worst
+
+
+def main():
+    host = Host()
+    ap = argparse.ArgumentParser(description='Check the BCM engine on a model of the panels')
+    ap.add_argument('--demo', choices=sorted(DEMOS),
+                    help='the geometry of this demo (the default is leds\')')
+    ap.add_argument('--size', help='frame buffer WxH')
+    ap.add_argument('--panel', help='panel WxH')
+    ap.add_argument('--scan', type=int, help='rows scanned')
+    ap.add_argument('--chain', type=int, help='panels in a chain')
+    ap.add_argument('--chains', type=int, help='chains clocked in parallel')
+    ap.add_argument('--panels', help='each panel as x,y,flags;... '
+                    '(flags 1 flip x, 2 flip y, 4 swap)')
+    ap.add_argument('--depth', type=int, default=4, help='bits (%(default)s)')
+    ap.add_argument('--gamma', type=float, default=round(host.DEFAULT_GAMMA, 3))
+    ap.add_argument('--unit', type=int, default=host.DEFAULT_UNIT,
+                    help='TIM3 ticks in the LSB (%(default)s)')
+    ap.add_argument('--brightness', type=int, default=host.BRIGHTNESS_MAX,
+                    help='0 to 255 (%(default)s)')
+    ap.add_argument('--dither', action='store_true')
+    ap.add_argument('--shift', choices=('cpu', 'dma', 'both'), default='both',
+                    help='which way the planes go out (%(default)s)')
+    args = ap.parse_args()
+
+    if not args.demo and not (args.size or args.panel or args.scan or
+                              args.chain or args.chains or args.panels):
+        args.demo = 'leds'
+    geo = parse_geometry(args, ap)
+    if not geo.panels:
+        geo.panels = [(j * geo.panel_width, k * geo.panel_height, 0)
+                      for k in range(geo.chains) for j in range(geo.chain)]
+    if not host.geometry(geo):
+        ap.error('hub75_init() would turn this geometry down')
+    top = host.MAX_DEPTH
+    if not 1 <= args.depth <= top:
+        ap.error('--depth is 1 to %d' % top)
+    if not 0 <= args.brightness <= host.BRIGHTNESS_MAX:
+        ap.error('--brightness is 0 to %d' % host.BRIGHTNESS_MAX)
+    if args.unit <= 0 or (args.unit << (top - 1)) > 0xffff:
+        ap.error('--unit is 1 to %d' % (0xffff >> (top - 1)))
+
+    failed = 0
+    for shift in (('cpu', 'dma') if args.shift == 'both' else (args.shift,)):
+        if shift == 'dma' and geo.panel_width * geo.chain > host.MAX_CLOCKS:
+            print('dma: rows longer than HUB75_MAX_CLOCKS, the engine uses the CPU')
+            continue
+        errors, worst = check(host, geo, args, shift == 'dma')
+        if errors:
+            failed = 1
+            print('%s: FAILED' % shift)
+            for e in errors[:10]:
+                print('  ' + e)
+            continue
+        print('%s: %d rows x %d bits of %d clocks%s, every LED lit as asked, '
+              'within %.3f of a step of the gamma curve%s'
+              % (shift, geo.scan, args.depth, geo.panel_width * geo.chain,
+                 ' x 2 chains' if geo.chains > 1 else '', worst,
+                 ' over %d frames' % DITHER_FRAMES if args.dither else ''))
+
+    # the refresh rate this comes to with DMA, a plane shifts while one is lit
+    shift_s = geo.panel_width * geo.chain * host.DMA_PERIOD / float(CPU_HZ)
+    frame_s = sum(max((args.unit << i) / TIM3_HZ, shift_s)
+                  for i in range(args.depth)) * geo.scan
+    bound = [i for i in range(args.depth) if (args.unit << i) / TIM3_HZ < shift_s]
+    print('refresh with DMA about %d Hz, a plane shifts in %.1f uS%s'
+          % (1 / frame_s, shift_s * 1e6,
+             ', bits 0-%d wait for it' % bound[-1] if bound else ''))
+    return failed
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,450 @@
+#!/usr/bin/env python3
+#
+# hub75_stream.py -- send frames to the LED panel demos over the console
+#
+# Press 'Z' on the board's console first (or let this do it with
+# --start), then run this with the serial port. It sends a test pattern
+# or image in the chosen pixel format, waits for each frame to be
+# acknowledged and reports the frame rate and the latency from the last
+# byte sent to the acknowledgement. It always ends the stream, which
+# puts the board back on its console at 115200 baud.
+#
+# With --delta each frame after the first is sent as its changes to
+# the one before (XOR, run length coded inside rectangles around the
+# rows that changed), unless the whole frame would be shorter. --bench
+# doesn't need a board, it encodes each pattern both ways and reports
+# the frame rate the link could carry.
+#
+# The wire format is described in demos/util/stream.h. Needs pyserial,
+# and PIL to read anything other than binary PPM files.
+#
+
+import argparse
+import math
+import struct
+import sys
+import time
+
+import serial
+
+MAGIC = b'HS'
+FRAME, SHOT, BAUD, END, DELTA = 1, 2, 3, 4, 5
+REPLY = 0x80
+FORMATS = {'rgb111': 0, 'rgb332': 1, 'rgb444': 2, 'rgb565': 3}
+STATUS = ['ok', 'bad checksum', 'bad length', 'bad type', 'bad delta']
+SKIP, RUN, COPY, RECT = 0x00, 0x40, 0x80, 0xc0
+DELTA_MAX = 4096
+CONSOLE_BAUD = 115200
+
+
+def fletcher(data):
+    a = b = 0
+    for c in data:
+        a = (a + c) % 255
+        b = (b + a) % 255
+    return (b << 8) | a
+
+
+def header(kind, fmt, seq, payload):
+    h = struct.pack('<2sBBHHH', MAGIC, kind, fmt, seq & 0xffff,
+                    len(payload), fletcher(payload))
+    return h + struct.pack('<H', fletcher(h))
+
+
+# Pixels are (r, g, b) tuples of 0 - 255, a frame is a list of rows.
+
+def pack(frame, fmt):
+    px = [p for row in frame for p in row]
+    if fmt == 'rgb111':
+        n = [(r >> 7) << 2 | (g >> 7) << 1 | (b >> 7) for r, g, b in px]
+        return bytes(n[i] | n[i + 1] << 4 for i in range(0, len(n), 2))
+    if fmt == 'rgb332':
+        return bytes((r & 0xe0) | (g & 0xe0) >> 3 | b >> 6 for r, g, b in px)
+    if fmt == 'rgb444':
+        out = bytearray()
+        for i in range(0, len(px), 2):
+            (r0, g0, b0), (r1, g1, b1) = px[i], px[i + 1]
+            out += bytes([(r0 & 0xf0) | g0 >> 4, (b0 & 0xf0) | r1 >> 4,
+                          (g1 & 0xf0) | b1 >> 4])
+        return bytes(out)
+    return b''.join(struct.pack('<H', (r & 0xf8) << 8 | (g & 0xfc) << 3 |
+                                b >> 3) for r, g, b in px)
+
+
+def board565(frame, fmt):
+    """The RGB565 frame buffer the board ends up with for a frame."""
+    px = [p for row in frame for p in row]
+    if fmt == 'rgb111':
+        return [(0xf800 if r & 0x80 else 0) | (0x07e0 if g & 0x80 else 0) |
+                (0x001f if b & 0x80 else 0) for r, g, b in px]
+    if fmt == 'rgb332':
+        px = [((r >> 5) * 255 // 7, (g >> 5) * 255 // 7, (b >> 6) * 255 // 3)
+              for r, g, b in px]
+    elif fmt == 'rgb444':
+        return [((r >> 4) << 1 | r >> 7) << 11 | ((g >> 4) << 2 | g >> 6) << 5 |
+                ((b >> 4) << 1 | b >> 7) for r, g, b in px]
+    return [(r & 0xf8) << 8 | (g & 0xfc) << 3 | b >> 3 for r, g, b in px]
+
+
+def rle(px):
+    out = bytearray()
+    lit = []
+
+    def flush():
+        if lit:
+            out.append(COPY | (len(lit) - 1))
+            for v in lit:
+                out.extend(struct.pack('<H', v))
+            del lit[:]
+
+    n = len(px)
+    while n and px[n - 1] == 0:
+        n -= 1
+    i = 0
+    while i < n:
+        j = i + 1
+        while j < n and j - i < 64 and px[j] == px[i]:
+            j += 1
+        if px[i] == 0 or j - i > 1:
+            flush()
+            out.append((SKIP if px[i] == 0 else RUN) | (j - i - 1))
+            if px[i]:
+                out.extend(struct.pack('<H', px[i]))
+            i = j
+        else:
+            lit.append(px[i])
+            if len(lit) == 64:
+                flush()
+            i += 1
+    flush()
+    return out
+
+
+def encode_delta(prev, cur, w, h):
+    """The STREAM_DELTA payload that turns frame buffer prev into cur."""
+    x = [a ^ b for a, b in zip(prev, cur)]
+    rows = [y for y in range(h) if any(x[y * w:(y + 1) * w])]
+    # bands of changed rows, split where a RECT is cheaper than skipping
+    bands = []
+    for y in rows:
+        if bands and y - bands[-1][1] <= 2:
+            bands[-1][1] = y
+        else:
+            bands.append([y, y])
+    out = bytearray()
+    for y0, y1 in bands:
+        cols = [c for c in range(w)
+                if any(x[y * w + c] for y in range(y0, y1 + 1))]
+        x0, x1 = cols[0], cols[-1]
+        out += bytes([RECT, x0, y0, x1 - x0, y1 - y0])
+        out += rle([x[y * w + c] for y in range(y0, y1 + 1)
+                    for c in range(x0, x1 + 1)])
+    return bytes(out)
+
+
+def apply_delta(prev, data, w, h):
+    """What the board does with a delta, to check the encoder."""
+    fb = list(prev)
+    rx, ry, rw, rh = 0, 0, w, h
+    pos, i = 0, 0
+    while i < len(data):
+        op, n = data[i] & 0xc0, (data[i] & 0x3f) + 1
+        i += 1
+        if op == RECT:
+            rx, ry, rw, rh = data[i], data[i + 1], data[i + 2] + 1, data[i + 3] + 1
+            pos, i = 0, i + 4
+            continue
+        if op == RUN:
+            v, = struct.unpack_from('<H', data, i)
+            i += 2
+        for k in range(n):
+            if op == COPY:
+                v, = struct.unpack_from('<H', data, i)
+                i += 2
+            if op != SKIP:
+                assert pos < rw * rh
+                fb[(ry + pos // rw) * w + rx + pos % rw] ^= v
+            pos += 1
+    return fb
+
+
+# a 5x7 font for the scrolling text, a byte per column, bit 0 at the top
+DIGITS = {
+    '0': (0x3e, 0x51, 0x49, 0x45, 0x3e), '1': (0x00, 0x42, 0x7f, 0x40, 0x00),
+    '2': (0x42, 0x61, 0x51, 0x49, 0x46), '3': (0x21, 0x41, 0x45, 0x4b, 0x31),
+    '4': (0x18, 0x14, 0x12, 0x7f, 0x10), '5': (0x27, 0x45, 0x45, 0x45, 0x39),
+    '6': (0x3c, 0x4a, 0x49, 0x49, 0x30), '7': (0x01, 0x71, 0x09, 0x05, 0x03),
+    '8': (0x36, 0x49, 0x49, 0x49, 0x36), '9': (0x06, 0x49, 0x49, 0x29, 0x1e),
+    ':': (0x00, 0x36, 0x36, 0x00, 0x00), ' ': (0x00, 0x00, 0x00, 0x00, 0x00),
+}
+
+
+def line(rows, x0, y0, x1, y1, c):
+    n = max(abs(x1 - x0), abs(y1 - y0), 1)
+    for i in range(n + 1):
+        rows[int(round(y0 + (y1 - y0) * i / n))][
+            int(round(x0 + (x1 - x0) * i / n))] = c
+
+
+def pattern(name, n, w, h):
+    if name == 'clock':
+        # an analog clock, a frame a second
+        rows = [[(0, 0, 0)] * w for y in range(h)]
+        cx, cy, r = w // 2, h // 2, min(w, h) // 2 - 2
+        t = 10 * 3600 + 8 * 60 + n
+        for i in range(12):
+            a = i * math.pi / 6
+            line(rows, cx + int(r * 0.85 * math.sin(a)),
+                 cy - int(r * 0.85 * math.cos(a)), cx + int(r * math.sin(a)),
+                 cy - int(r * math.cos(a)), (0, 0, 255))
+        for frac, length, c in (((t / 43200.0) % 1, 0.5, (255, 0, 0)),
+                                ((t / 3600.0) % 1, 0.75, (0, 255, 0)),
+                                ((t / 60.0) % 1, 0.9, (255, 255, 0))):
+            a = frac * 2 * math.pi
+            line(rows, cx, cy, cx + int(r * length * math.sin(a)),
+                 cy - int(r * length * math.cos(a)), c)
+        return rows
+    if name == 'scroll':
+        # double size text moving a pixel a frame
+        cols = []
+        for ch in '12:34:56 ':
+            cols += [b for b in DIGITS[ch] for k in (0, 1)] + [0, 0]
+        rows = [[(0, 0, 0)] * w for y in range(h)]
+        top = (h - 14) // 2
+        for x in range(w):
+            bits = cols[(x + n) % len(cols)]
+            for y in range(14):
+                if bits >> (y // 2) & 1:
+                    rows[top + y][x] = (255, 160, 0)
+        return rows
+    if name == 'bars':
+        colors = [(255, 255, 255), (255, 255, 0), (0, 255, 255), (0, 255, 0),
+                  (255, 0, 255), (255, 0, 0), (0, 0, 255), (0, 0, 0)]
+        return [[colors[((x + n) * 8 // w) % 8] for x in range(w)]
+                for y in range(h)]
+    if name == 'plasma':
+        t = n / 10.0
+        rows = []
+        for y in range(h):
+            row = []
+            for x in range(w):
+                v = (math.sin(x / 6.0 + t) + math.sin(y / 5.0 - t) +
+                     math.sin((x + y) / 9.0 + t / 2)) / 3
+                row.append((int(127 + 127 * math.sin(v * math.pi)),
+                            int(127 + 127 * math.sin(v * math.pi + 2.1)),
+                            int(127 + 127 * math.sin(v * math.pi + 4.2))))
+            rows.append(row)
+        return rows
+    # a box bouncing around a gradient
+    bx = abs((n % (2 * (w - 8))) - (w - 8))
+    by = abs(((n * 3 // 2) % (2 * (h - 8))) - (h - 8))
+    return [[(255, 255, 255) if bx <= x < bx + 8 and by <= y < by + 8 else
+             (x * 255 // (w - 1), y * 255 // (h - 1), 64)
+             for x in range(w)] for y in range(h)]
+
+
+PATTERNS = ['bars', 'box', 'clock', 'plasma', 'scroll']
+
+
+def read_ppm(name):
+    with open(name, 'rb') as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b'P6' or fields[3] != b'255':
+        raise ValueError('%s: only 8 bit binary PPM files' % name)
+    w, h = int(fields[1]), int(fields[2])
+    pix = data[pos + 1:pos + 1 + w * h * 3]
+    return w, h, [[tuple(pix[(y * w + x) * 3:(y * w + x) * 3 + 3])
+                   for x in range(w)] for y in range(h)]
+
+
+def load_image(name, w, h):
+    try:
+        iw, ih, rows = read_ppm(name)
+    except ValueError:
+        from PIL import Image
+        img = Image.open(name).convert('RGB')
+        iw, ih = img.size
+        rows = [[img.getpixel((x, y)) for x in range(iw)] for y in range(ih)]
+    # nearest neighbour to the panel size
+    return [[rows[y * ih // h][x * iw // w] for x in range(w)]
+            for y in range(h)]
+
+
+def write_ppm(name, data, w, h):
+    with open(name, 'wb') as f:
+        f.write(b'P6\n%d %d\n255\n' % (w, h))
+        for i in range(w * h):
+            c, = struct.unpack_from('<H', data, i * 2)
+            r, g, b = c >> 11, (c >> 5) & 0x3f, c & 0x1f
+            f.write(bytes([r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2]))
+
+
+class Panel:
+    def __init__(self, port, baud, timeout):
+        self.ser = serial.Serial(port, baud, timeout=timeout)
+        self.seq = 0
+
+    def reply(self, kind):
+        # skip anything that isn't a reply header (console output)
+        buf = b''
+        while True:
+            c = self.ser.read(1)
+            if not c:
+                raise IOError('no reply from the board')
+            buf = (buf + c)[-12:]
+            if len(buf) < 12 or buf[:2] != MAGIC:
+                continue
+            _, t, status, seq, n, csum, check = struct.unpack('<2sBBHHHH', buf)
+            if fletcher(buf[:10]) == check:
+                break
+        data = self.ser.read(n)
+        if len(data) != n or fletcher(data) != csum:
+            raise IOError('short or corrupt reply payload')
+        if t != kind | REPLY:
+            raise IOError('reply of type %d to a message of type %d' % (t, kind))
+        return status, data
+
+    def send(self, kind, payload=b'', fmt=0):
+        self.seq += 1
+        self.ser.write(header(kind, fmt, self.seq, payload) + payload)
+        self.ser.flush()
+        return self.reply(kind)
+
+    def baud(self, rate):
+        status, _ = self.send(BAUD, struct.pack('<I', rate))
+        if status:
+            raise IOError('board refused %d baud: %s' % (rate, STATUS[status]))
+        self.ser.flush()
+        time.sleep(0.01)
+        self.ser.baudrate = rate
+
+
+def message(prev, frame, fmt, delta):
+    """The smallest message that shows frame, and what the board will hold."""
+    payload, fb = pack(frame, fmt), board565(frame, fmt)
+    if delta and prev is not None:
+        d = encode_delta(prev, fb, len(frame[0]), len(frame))
+        if len(d) <= DELTA_MAX and len(d) < len(payload):
+            return DELTA, d, FORMATS['rgb565'], fb
+    return FRAME, payload, FORMATS[fmt], fb
+
+
+def fps(size, baud):
+    # stop and wait, the message and the reply header at 10 bits a byte
+    return baud / ((12 + size + 12) * 10.0)
+
+
+def bench(args, w, h):
+    print('%d frames of each at %d baud, bytes a frame and frames a second'
+          % (args.frames, args.baud))
+    print('%-8s %-8s %14s %14s' % ('pattern', 'format', 'frames', 'deltas'))
+    for name in PATTERNS:
+        for fmt in sorted(FORMATS):
+            prev = None
+            full = sent = 0
+            for n in range(args.frames):
+                frame = pattern(name, n, w, h)
+                kind, payload, _, fb = message(prev, frame, fmt, True)
+                if kind == DELTA:
+                    assert apply_delta(prev, payload, w, h) == fb
+                full += len(pack(frame, fmt))
+                sent += len(payload)
+                prev = fb
+            full /= float(args.frames)
+            sent /= float(args.frames)
+            print('%-8s %-8s %6d %7.1f %6d %7.1f' % (name, fmt, full,
+                  fps(full, args.baud), sent, fps(sent, args.baud)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Stream frames to a HUB75 demo')
+    ap.add_argument('port', nargs='?')
+    ap.add_argument('--baud', type=int, default=CONSOLE_BAUD,
+                    help='console baud rate (%(default)s)')
+    ap.add_argument('--fast', type=int, metavar='BAUD',
+                    help='switch to this baud rate for the stream (max 2625000)')
+    ap.add_argument('--format', choices=sorted(FORMATS), default='rgb565')
+    ap.add_argument('--pattern', choices=PATTERNS, default='box')
+    ap.add_argument('--image', help='show this (PPM, or anything PIL reads)')
+    ap.add_argument('--frames', type=int, default=100)
+    ap.add_argument('--size', default='64x64', help='panel WxH (%(default)s)')
+    ap.add_argument('--delta', action='store_true',
+                    help='send changes to the last frame when they are shorter')
+    ap.add_argument('--bench', action='store_true',
+                    help="compare frames and deltas for each pattern (no board)")
+    ap.add_argument('--start', action='store_true',
+                    help="send 'Z' to start the stream from the console")
+    ap.add_argument('--shot', metavar='FILE',
+                    help='save a screenshot to FILE (PPM) at the end')
+    args = ap.parse_args()
+
+    w, h = (int(v) for v in args.size.split('x'))
+    if args.bench:
+        return bench(args, w, h)
+    if not args.port:
+        ap.error('the serial port is needed unless it is --bench')
+    panel = Panel(args.port, args.baud, 2)
+    if args.start:
+        panel.ser.write(b'Z')
+        time.sleep(0.1)
+        panel.ser.reset_input_buffer()
+    if args.fast:
+        panel.baud(args.fast)
+
+    image = load_image(args.image, w, h) if args.image else None
+    prev = None
+    good = bad = deltas = size = 0
+    latency = []
+    try:
+        start = time.time()
+        for n in range(args.frames):
+            frame = image or pattern(args.pattern, n, w, h)
+            kind, payload, fmt, fb = message(prev, frame, args.format,
+                                             args.delta)
+            sent = time.time()
+            status, _ = panel.send(kind, payload, fmt)
+            latency.append(time.time() - sent)
+            size += 12 + len(payload)
+            if status:
+                # the next one goes as a whole frame
+                bad += 1
+                prev = None
+                print('frame %d: %s' % (n, STATUS[status]))
+            else:
+                good += 1
+                deltas += kind == DELTA
+                prev = fb
+        elapsed = time.time() - start
+        if args.shot:
+            status, data = panel.send(SHOT)
+            write_ppm(args.shot, data, w, h)
+            print('screenshot saved to %s' % args.shot)
+    finally:
+        panel.send(END)
+        panel.ser.close()
+
+    n = good + bad
+    print('%d frames (%d rejected, %d deltas) averaging %d bytes in %.2fs: '
+          '%.1f fps, %d bytes/s' % (n, bad, deltas, size // n, elapsed,
+                                     n / elapsed, size / elapsed))
+    latency.sort()
+    print('round trip (mS): min %.1f, median %.1f, max %.1f'
+          % (latency[0] * 1000, latency[len(latency) // 2] * 1000,
+             latency[-1] * 1000))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+#
+# qrfast_check.py -- check demos/util/qrfast.c against the QR standard
+#
+# Builds qrfast.c for the host with a small driver and reads every code
+# it makes back the way a reader would: function patterns, both copies
+# of the format information, the dark module, the mask, the zig zag of
+# codeword bits, Reed-Solomon syndromes of every block, then the byte
+# mode header, the string, terminator and padding. It does that for
+# every error correction level and each of versions 1 - 4 (the shortest
+# and longest strings of each), and for runs of time stamps like the
+# clocks', where after the first code qrf_encode() only redraws the
+# codewords that changed.
+#
+# If the libqrcode submodule is checked out, the same strings are also
+# encoded by libqrencode, with the mask qrfast picked, and the two
+# compared module for module. The mask libqrencode picks by itself is
+# reported, qrfast only picks one for the first code and any reader
+# copes with either.
+#
+# Exits 1 if anything doesn't check out.
+#
+
+import argparse
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+
+DRIVER = r'''
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "qrfast.h"
+#ifdef WITH_LIBQRCODE
+#include <qrencode.h>
+extern QRcode *QRcode_encodeMask(QRinput *input, int mask);
+#endif
+
+static struct qrf_code q;
+
+static void
+modules(const char *tag, int width, const unsigned char *data)
+{
+	int		x, y;
+
+	printf("%s %d\n", tag, width);
+	for (y = 0; y < width; y++) {
+		for (x = 0; x < width; x++) {
+			putchar('0' + (data[y * width + x] & 1));
+		}
+		putchar('\n');
+	}
+}
+
+/* each line is a level, a space and the string */
+int
+main(void)
+{
+	char	line[256], *s;
+	int		r;
+
+	q.len = -1;
+	while (fgets(line, sizeof(line), stdin)) {
+		line[strcspn(line, "\n")] = 0;
+		s = line + 2;
+		if ((line[0] - '0' != q.level) || ((int) strlen(s) != q.len)) {
+			if (qrf_setup(&q, line[0] - '0', strlen(s)) < 0) {
+				q.len = -1;
+				printf("X\n");
+				continue;
+			}
+		}
+		r = qrf_encode(&q, s);
+		printf("Q %d %d %d\n", q.version, q.mask, r);
+		modules("q", q.width, q.data);
+#ifdef WITH_LIBQRCODE
+		{
+			QRinput	*in = QRinput_new2(q.version, q.level);
+			QRcode	*c;
+
+			QRinput_append(in, QR_MODE_8, strlen(s), (unsigned char *) s);
+			c = QRcode_encodeMask(in, q.mask);
+			modules("m", c->width, c->data);
+			QRcode_free(c);
+			QRinput_free(in);
+			c = QRcode_encodeString(s, 0, q.level, QR_MODE_8, 1);
+			modules("a", c->width, c->data);
+			QRcode_free(c);
+		}
+#endif
+	}
+	return 0;
+}
+'''
+
+LEVELS = 'LMQH'
+TOTAL = [26, 44, 70, 100]                       # codewords, versions 1 - 4
+EC_LEN = [[7, 10, 13, 17], [10, 16, 22, 28],    # per block, L M Q H
+          [15, 26, 18, 22], [20, 18, 26, 16]]
+BLOCKS = [[1, 1, 1, 1], [1, 1, 1, 1], [1, 1, 2, 2], [1, 2, 2, 4]]
+FORMAT_LEVEL = [1, 0, 3, 2]                     # the format's 2 bits for L M Q H
+
+EXP = [0] * 512
+LOG = [0] * 256
+_x = 1
+for _i in range(255):
+    EXP[_i], LOG[_x] = _x, _i
+    _x <<= 1
+    if _x & 0x100:
+        _x ^= 0x11d
+for _i in range(255, 512):
+    EXP[_i] = EXP[_i - 255]
+
+
+def gf_mul(a, b):
+    return EXP[LOG[a] + LOG[b]] if a and b else 0
+
+
+def format_bits(level, mask):
+    d = FORMAT_LEVEL[level] << 3 | mask
+    r = d
+    for _ in range(10):
+        r = (r << 1) ^ ((r >> 9) * 0x537)
+    return ((d << 10) | r) ^ 0x5412
+
+
+def capacity(v, level):
+    """Bytes a version holds in byte mode."""
+    data = TOTAL[v - 1] - EC_LEN[v - 1][level] * BLOCKS[v - 1][level]
+    return (data * 8 - 12) // 8
+
+
+def function_modules(v):
+    """Module -> its fixed color, or None for the format areas."""
+    n = 17 + 4 * v
+    f = {}
+    for r0, c0 in ((0, 0), (0, n - 7), (n - 7, 0)):
+        for r in range(r0 - 1, r0 + 8):
+            for c in range(c0 - 1, c0 + 8):
+                if 0 <= r < n and 0 <= c < n:
+                    dr, dc = r - r0, c - c0
+                    ring = max(abs(dr - 3), abs(dc - 3))
+                    f[r, c] = int(ring != 2 and ring != 4)
+    for i in range(8, n - 8):
+        f[6, i] = f[i, 6] = int(i % 2 == 0)
+    if v > 1:
+        a = 4 * v + 10
+        for r in range(a - 2, a + 3):
+            for c in range(a - 2, a + 3):
+                f[r, c] = int(max(abs(r - a), abs(c - a)) != 1)
+    for i in range(9):
+        f.setdefault((8, i), None)
+        f.setdefault((i, 8), None)
+    for i in range(8):
+        f[8, n - 1 - i] = f[n - 1 - i, 8] = None
+    f[n - 8, 8] = 1                             # the dark module
+    return f
+
+
+def mask_bit(m, i, j):
+    return (
+        (i + j) % 2 == 0, i % 2 == 0, j % 3 == 0, (i + j) % 3 == 0,
+        (i // 2 + j // 3) % 2 == 0, (i * j) % 2 + (i * j) % 3 == 0,
+        ((i * j) % 2 + (i * j) % 3) % 2 == 0,
+        ((i + j) % 2 + (i * j) % 3) % 2 == 0)[m]
+
+
+def decode(m):
+    """(level, mask, string) of a code, or raise ValueError saying why."""
+    n = len(m)
+    v = (n - 17) // 4
+    if n != 17 + 4 * v or not 1 <= v <= 4:
+        raise ValueError('%d modules wide' % n)
+    func = function_modules(v)
+    for (r, c), want in func.items():
+        if want is not None and m[r][c] != want:
+            raise ValueError('function module (%d, %d) is wrong' % (c, r))
+    one = [m[8][c] for c in (0, 1, 2, 3, 4, 5, 7, 8)] + \
+        [m[r][8] for r in (7, 5, 4, 3, 2, 1, 0)]
+    two = [m[r][8] for r in range(n - 1, n - 8, -1)] + \
+        [m[8][c] for c in range(n - 8, n)]
+    fmt = int(''.join(map(str, one)), 2)
+    if fmt != int(''.join(map(str, two)), 2):
+        raise ValueError('the two copies of the format differ')
+    found = [(lv, mk) for lv in range(4) for mk in range(8)
+             if format_bits(lv, mk) == fmt]
+    if not found:
+        raise ValueError('format %04x isn\'t a format code' % fmt)
+    level, mask = found[0]
+
+    bits = []
+    col, up = n - 1, True
+    while col > 0:
+        if col == 6:
+            col -= 1
+        for r in (range(n - 1, -1, -1) if up else range(n)):
+            for c in (col, col - 1):
+                if (r, c) not in func:
+                    bits.append(m[r][c] ^ mask_bit(mask, r, c))
+        up = not up
+        col -= 2
+    total = TOTAL[v - 1]
+    cw = [int(''.join(map(str, bits[i * 8:i * 8 + 8])), 2) for i in range(total)]
+    ec, nb = EC_LEN[v - 1][level], BLOCKS[v - 1][level]
+    k = (total - ec * nb) // nb
+    blocks = [[cw[j * nb + b] for j in range(k)] +
+              [cw[k * nb + j * nb + b] for j in range(ec)] for b in range(nb)]
+    for b, blk in enumerate(blocks):
+        for p in range(ec):
+            s = 0
+            for c in blk:
+                s = gf_mul(s, EXP[p]) ^ c
+            if s:
+                raise ValueError('block %d fails Reed-Solomon' % b)
+
+    data = [c for blk in blocks for c in blk[:k]]
+    bs = ''.join(format(c, '08b') for c in data)
+    if bs[:4] != '0100':
+        raise ValueError('not byte mode')
+    count = int(bs[4:12], 2)
+    end = 12 + 8 * count
+    if end > len(bs):
+        raise ValueError('count %d is too long' % count)
+    text = bytes(int(bs[12 + 8 * i:20 + 8 * i], 2) for i in range(count))
+    pad = (min(end + 4, len(bs)) + 7) // 8 * 8
+    if '1' in bs[end:pad]:
+        raise ValueError('terminator or bit padding isn\'t zero')
+    if any(c != (0xec, 0x11)[i % 2] for i, c in enumerate(data[pad // 8:])):
+        raise ValueError('pad codewords aren\'t 0xec 0x11')
+    return level, mask, text.decode('latin-1')
+
+
+def build(tmp, here, libqrcode):
+    util = os.path.join(here, '..', 'demos', 'util')
+    src = os.path.join(tmp, 'drv.c')
+    with open(src, 'w') as f:
+        f.write(DRIVER)
+    cmd = ['cc', '-O2', '-w', '-I', util, '-o', os.path.join(tmp, 'drv'), src,
+           os.path.join(util, 'qrfast.c')]
+    if libqrcode:
+        lib = [os.path.join(libqrcode, n) for n in sorted(os.listdir(libqrcode))
+               if n.endswith('.c') and n not in ('qrenc.c', 'view_qrcode.c')]
+        # QRcode_encodeMask() is only static in release builds
+        cmd += ['-DWITH_LIBQRCODE', '-I', libqrcode, '-DSTATIC_IN_RELEASE=',
+                '-D__STATIC=',
+                '-DMAJOR_VERSION=3', '-DMINOR_VERSION=9', '-DMICRO_VERSION=0',
+                '-DVERSION="3.9.0"'] + lib
+    r = subprocess.run(cmd, capture_output=True, text=True)
+    if r.returncode:
+        raise RuntimeError(r.stderr)
+    return os.path.join(tmp, 'drv')
+
+
+def run(drv, lines):
+    out = subprocess.run([drv], input='\n'.join(lines) + '\n', capture_output=True,
+                         text=True, check=True).stdout.split('\n')
+    res, i = [], 0
+    while i < len(out) and out[i]:
+        if out[i] == 'X':
+            res.append(None)
+            i += 1
+            continue
+        _, v, mask, r = out[i].split()
+        i += 1
+        codes = {}
+        while i < len(out) and out[i][:1] in ('q', 'm', 'a'):
+            tag, w = out[i].split()
+            codes[tag] = [[int(ch) for ch in out[i + 1 + y]] for y in range(int(w))]
+            i += 1 + int(w)
+        res.append((int(v), int(mask), int(r), codes))
+    return res
+
+
+def test_lines(rng):
+    """(level, string, version expected) for every level and version."""
+    out = []
+    chars = 'abcXYZ0123:. -'
+    for level in range(4):
+        lens = [1]
+        for v in range(1, 5):
+            cap = capacity(v, level)
+            lens += [cap, cap + 1]
+        for n in lens:
+            s = ''.join(rng.choice(chars) for _ in range(n))
+            want = next((v for v in range(1, 5) if n <= capacity(v, level)), None)
+            out.append((level, s, want))
+        # the clocks' time stamps, second by second and by 100mS
+        for frac in (0, 1):
+            t = rng.randrange(10 ** 7)
+            for k in range(60):
+                u = t + k * (100 if frac else 1000)
+                s = 'Mon Oct 31 2016, %2d:%02d:%02d%s PDT' % (
+                    u // 3600000 % 24, u // 60000 % 60, u // 1000 % 60,
+                    '.%03d' % (u % 1000) if frac else '')
+                out.append((level, s, next(v for v in range(1, 5)
+                                           if len(s) <= capacity(v, level))))
+    return out
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description='Check qrfast.c against the QR standard')
+    ap.add_argument('--libqrcode', default=os.path.join(here, '..', 'libqrcode'),
+                    help='libqrencode sources to compare with (%(default)s)')
+    ap.add_argument('--seed', type=int, default=1)
+    args = ap.parse_args()
+
+    lib = args.libqrcode
+    if not os.path.exists(os.path.join(lib, 'qrencode.h')):
+        print('no libqrencode in %s, only checking against the standard'
+              % os.path.normpath(lib))
+        lib = None
+    tmp = tempfile.mkdtemp()
+    try:
+        try:
+            drv = build(tmp, here, lib)
+        except RuntimeError as e:
+            if not lib:
+                print('qrfast.c didn\'t build:\n' + str(e), file=sys.stderr)
+                return 1
+            print('libqrencode didn\'t build for the host, only checking '
+                  'against the standard:\n' + str(e).strip()[:400])
+            lib = None
+            drv = build(tmp, here, None)
+        tests = test_lines(random.Random(args.seed))
+        res = run(drv, ['%d %s' % (lv, s) for lv, s, _ in tests])
+    finally:
+        shutil.rmtree(tmp)
+
+    errors = []
+    seen = set()
+    read = partial = masks_same = masks = 0
+    for (level, s, want), r in zip(tests, res):
+        what = '%s %r' % (LEVELS[level], s)
+        if r is None:
+            if want is not None:
+                errors.append('%s: qrf_setup() refused it' % what)
+            continue
+        v, mask, count, codes = r
+        if want is None:
+            errors.append('%s: too long for version 4 but encoded' % what)
+            continue
+        if v != want:
+            errors.append('%s: version %d, expected %d' % (what, v, want))
+        if count < TOTAL[v - 1]:
+            partial += 1
+        try:
+            got = decode(codes['q'])
+        except ValueError as e:
+            errors.append('%s: %s' % (what, e))
+            continue
+        if got != (level, mask, s):
+            errors.append('%s: reads as %s, mask %d %r' % (what, LEVELS[got[0]],
+                                                          got[1], got[2]))
+            continue
+        seen.add((level, v))
+        read += 1
+        if 'm' in codes:
+            if codes['m'] != codes['q']:
+                diff = sum(a != b for ra, rb in zip(codes['m'], codes['q'])
+                           for a, b in zip(ra, rb))
+                errors.append('%s: %d modules differ from libqrencode\'s'
+                              % (what, diff))
+            masks += 1
+            masks_same += decode(codes['a'])[1] == mask
+    for level in range(4):
+        for v in range(1, 5):
+            if (level, v) not in seen:
+                errors.append('%s: no version %d code checked' % (LEVELS[level], v))
+
+    for e in errors[:20]:
+        print(e)
+    if errors:
+        print('FAILED, %d problems' % len(errors))
+        return 1
+    print('%d codes read back, levels L M Q H at versions 1 - 4, %d of them '
+          'redrawn only in part' % (read, partial))
+    if lib:
+        print('all %d the same as libqrencode\'s module for module, which picks '
+              'the same mask for %d' % (masks, masks_same))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+#
+# wall_sim.py -- simulate a wall of boards kept in step by a sync line
+#
+# Models demos/util/wall.c on the host: board 0 draws a frame a slice
+# at a time, sends each other board its slice over the UART (one after
+# the other, the link is shared), waits the settle time and pulses the
+# sync line. Each board swaps to its slice at the sync edge if the
+# slice came in whole and was unpacked by then, and its scan, which
+# free-runs at its own refresh rate from a random phase, lights it at
+# the next frame boundary.
+#
+# It checks that no board swaps to a slice that isn't all there (the
+# thing the sync line is for), counts the frames some board missed and
+# so showed the one before for a frame longer, and reports the swap
+# skew: how far apart the boards light each frame, and for how much of
+# the time they show different frames. Exits 1 if a board tore, which
+# --trust (leaving out wall_poll()'s check that no slice came in on top
+# of the one it was unpacking) shows with a slow enough --unpack-ns.
+#
+# Times are in microseconds. Everything that is random comes from
+# --seed, so a run can be repeated.
+#
+
+import argparse
+import random
+import sys
+
+HDR_BYTES = 12                  # struct stream_hdr
+BITS_PER_BYTE = 10              # 8N1
+FORMATS = {'rgb111': 0.5, 'rgb332': 1, 'rgb565': 2}
+STREAM_MAX_BAUD = 2625000
+SETTLE_US = 500                 # WALL_SETTLE
+PULSE_US = 1                    # WALL_SYNC_PULSE
+
+
+class Board:
+    def __init__(self, n, args, rng):
+        self.n = n
+        self.args = args
+        ppm = rng.uniform(-args.ppm, args.ppm)
+        self.period = 1e6 / args.refresh * (1 + ppm / 1e6)
+        self.phase = rng.uniform(0, self.period)
+        self.ready = False      # wall.c's 'ready'
+        self.seq = None         # the slice it stands for
+        self.whole = False      # and whether it really is all there
+        self.unpacking = None
+        self.clobbered = False  # a slice came in on top of one being unpacked
+        self.shown = []         # (lit at, seq)
+        self.frames = self.missed = self.errors = self.overruns = 0
+        self.torn = self.stale = 0
+        self.lags = []
+
+    def boundary(self, t):
+        # first frame boundary of this board's scan at or after t
+        k = -(-(t - self.phase) // self.period)
+        return self.phase + k * self.period
+
+    def event(self, t, kind, seq):
+        if kind == HDR:
+            # dma1_stream5_isr(), the slice goes on the end of the buffer
+            if self.ready:
+                self.ready = False
+                self.overruns += 1
+            if self.unpacking is not None:
+                self.clobbered = True
+        elif kind == BAD:
+            self.errors += 1
+        elif kind == UNPACK:
+            self.unpacking = seq
+            self.clobbered = False
+        elif kind == READY:
+            # wall_poll() doesn't set 'ready' if a slice started meanwhile
+            self.unpacking = None
+            if self.clobbered and not self.args.trust:
+                self.overruns += 1
+                return
+            self.ready, self.seq = True, seq
+            self.whole = not self.clobbered
+        elif kind == SYNC:
+            if not self.ready:
+                self.missed += 1
+                return
+            self.ready = False
+            if not self.whole:
+                self.torn += 1
+            elif self.seq != seq:
+                self.stale += 1
+            lit = self.boundary(t)
+            self.shown.append((lit, self.seq))
+            self.lags.append(lit - t)
+            self.frames += 1
+
+
+# event kinds, in the order they happen at the same time
+HDR, BAD, UNPACK, READY, SYNC = range(5)
+
+
+def slice_us(args, pixels):
+    payload = int(pixels * FORMATS[args.format])
+    return (HDR_BYTES + payload) * BITS_PER_BYTE * 1e6 / args.baud, \
+        payload * BITS_PER_BYTE * 1e6 / args.baud
+
+
+def showing(board, t):
+    # seq the board is lighting at time t (-1 before its first)
+    seq = -1
+    for lit, s in board.shown:
+        if lit > t:
+            break
+        seq = s
+    return seq
+
+
+def simulate(args):
+    rng = random.Random(args.seed)
+    w, h = args.size
+    pixels = w * h
+    boards = [Board(n, args, rng) for n in range(args.boards)]
+    send, payload = slice_us(args, pixels)
+    unpack = pixels * args.unpack_ns / 1000
+    frame_us = 1e6 / args.fps
+
+    # the master doesn't hear from the others, so its times come first
+    events = []
+    busy = [0.0] * len(boards)          # main loop unpacking until then
+    t = 0.0
+    slot = 0
+    for seq in range(args.frames):
+        # the pacer passes over slots the last frame ran into
+        while slot * frame_us < t:
+            slot += 1
+        t = slot * frame_us
+        for b in reversed(boards[1:]):
+            t += args.draw + send
+            lat = rng.uniform(0, args.latency)
+            events.append((t - payload + lat, HDR, b.n, seq))
+            if rng.random() < args.loss:
+                events.append((t + lat, BAD, b.n, seq))
+                continue
+            start = max(t + lat + rng.uniform(0, args.poll), busy[b.n])
+            busy[b.n] = start + unpack
+            events.append((start, UNPACK, b.n, seq))
+            events.append((busy[b.n], READY, b.n, seq))
+        t += args.draw                  # the master's own slice
+        events.append((t, READY, 0, seq))
+        edge = t + args.settle
+        for b in boards:
+            lat = rng.uniform(0, args.latency) if b.n else 0
+            events.append((edge + lat, SYNC, b.n, seq))
+        t = edge + PULSE_US
+    end = t
+
+    lit = {}
+    for at, kind, n, seq in sorted(events):
+        b = boards[n]
+        before = len(b.shown)
+        b.event(at, kind, seq)
+        if len(b.shown) > before and b.shown[-1][1] == seq:
+            lit.setdefault(seq, []).append(b.shown[-1][0])
+    skews = [max(v) - min(v) for v in lit.values() if len(v) == len(boards)]
+
+    # how long the boards showed different frames
+    times = sorted(at for b in boards for at, _ in b.shown)
+    mixed = 0.0
+    for a, b in zip(times, times[1:]):
+        if len({showing(bd, a) for bd in boards}) > 1:
+            mixed += b - a
+    return boards, send, unpack, end, skews, mixed
+
+
+def us(v):
+    return '%.0f' % v
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Simulate a wall of HUB75 boards')
+    ap.add_argument('--boards', type=int, default=4)
+    ap.add_argument('--size', default='64x32', help='slice WxH (%(default)s)')
+    ap.add_argument('--format', choices=sorted(FORMATS), default='rgb332')
+    ap.add_argument('--baud', type=int, default=STREAM_MAX_BAUD)
+    ap.add_argument('--fps', type=float, default=30, help='target wall frame rate')
+    ap.add_argument('--refresh', type=float, default=250,
+                    help='each board\'s refresh rate, Hz (%(default)s)')
+    ap.add_argument('--ppm', type=float, default=100,
+                    help='refresh clock error between boards')
+    ap.add_argument('--settle', type=float, default=SETTLE_US,
+                    help='uS from the last slice to the sync edge')
+    ap.add_argument('--draw', type=float, default=400,
+                    help='uS for the master to draw a slice')
+    ap.add_argument('--unpack-ns', type=float, default=60,
+                    help='nS per pixel to check and unpack a slice')
+    ap.add_argument('--poll', type=float, default=50,
+                    help='uS until the main loop gets to wall_poll()')
+    ap.add_argument('--latency', type=float, default=2,
+                    help='uS of interrupt latency, DMA and sync edge')
+    ap.add_argument('--loss', type=float, default=0,
+                    help='fraction of slices that arrive corrupted')
+    ap.add_argument('--trust', action='store_true',
+                    help='set ready after unpacking even if the next slice '
+                    'has started coming in (shows what that check is for)')
+    ap.add_argument('--frames', type=int, default=1000)
+    ap.add_argument('--seed', type=int, default=1)
+    args = ap.parse_args()
+    try:
+        args.size = tuple(int(v) for v in args.size.split('x'))
+    except ValueError:
+        ap.error('--size is WxH')
+    if not 2 <= args.boards <= 4:
+        ap.error('a wall is 2 to 4 boards')
+
+    boards, send, unpack, end, skews, mixed = simulate(args)
+    period = 1e6 / args.refresh
+    print('%d boards of %dx%d, %s at %d baud: %s uS a slice, %s uS to unpack'
+          % (args.boards, args.size[0], args.size[1], args.format, args.baud,
+             us(send), us(unpack)))
+    print('%d frames in %.2f S, %.1f frames a second (target %g)'
+          % (args.frames, end / 1e6, args.frames * 1e6 / end, args.fps))
+    print('board  shown  missed  errors  overruns  torn  stale  lag avg/min/max uS')
+    for b in boards:
+        lag = b.lags or [0]
+        print('%5d  %5d  %6d  %6d  %8d  %4d  %5d  %s/%s/%s'
+              % (b.n, b.frames, b.missed, b.errors, b.overruns, b.torn,
+                 b.stale, us(sum(lag) / len(lag)), us(min(lag)), us(max(lag))))
+    if skews:
+        over = sum(1 for s in skews if s > period + args.latency)
+        print('swap skew uS: avg %s, max %s (one refresh is %s), %d over'
+              % (us(sum(skews) / len(skews)), us(max(skews)), us(period), over))
+    print('%d frames not shown on every board, boards differ %.1f%% of the time'
+          % (args.frames - len(skews), 100 * mixed / end))
+    torn = sum(b.torn for b in boards)
+    if torn:
+        print('TORN: %d swaps to a slice that was not all there' % torn)
+        return 1
+    print('no torn swaps')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())